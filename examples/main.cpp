@@ -31,6 +31,28 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../include/sutfcpplib/utf_string.h"
+#include "../include/sutfcpplib/utf_compact_string.h"
+#include "../include/sutfcpplib/utf_rope.h"
+#include "../include/sutfcpplib/utf_cache.h"
+#include "../include/sutfcpplib/utf_encoding.h"
+#include "../include/sutfcpplib/utf_algorithm.h"
+#include "../include/sutfcpplib/utf_stream.h"
+#include "../include/sutfcpplib/utf_pipeline.h"
+#include "../include/sutfcpplib/utf_scratch.h"
+#include "../include/sutfcpplib/utf_json.h"
+#include "../include/sutfcpplib/utf_property.h"
+#include "../include/sutfcpplib/utf_casefold.h"
+#include "../include/sutfcpplib/utf_normalize.h"
+#include "../include/sutfcpplib/utf_grapheme.h"
+#include "../include/sutfcpplib/utf_split.h"
+#include "../include/sutfcpplib/utf_distance.h"
+#include "../include/sutfcpplib/utf_sort.h"
+#include "../include/sutfcpplib/utf_punycode.h"
+#include "../include/sutfcpplib/utf_segment.h"
+
+#include <deque>
+#include <sstream>
+#include <unordered_set>
 
 
 
@@ -212,6 +234,592 @@ static void string_support() noexcept
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void compact_string_support()
+{
+    using namespace sutf;
+
+    // store code points with the minimal fixed width
+
+    const compact_string latin1_str(u8"caf\u00e9"sv);
+    const compact_string ucs2_str(u"\u2190\u2705"sv);
+    const compact_string utf32_str(str_utf8);
+
+    assert(latin1_str.width() == 1 && latin1_str.size() == 4); // all code points fit in 1 byte.
+    assert(ucs2_str.width() == 2 && ucs2_str.size() == 2); // all code points fit in 2 bytes.
+    assert(utf32_str.width() == 4 && utf32_str.size() == 8); // string contains code points beyond BMP.
+
+
+
+    // access code points by index in constant time
+
+    assert(utf32_str[3] == 0x0001f602);
+    assert(utf32_str.substr(4, 2) == compact_string(U"\U00000042\U000000ae"sv));
+    assert(utf32_str.substr(4, 2).width() == 1); // substring is stored with its own minimal width.
+
+
+
+    // convert compact string to any string
+
+    assert(to_string(utf32_str) == str_char);
+    assert(to_u16string(utf32_str) == str_utf16);
+    assert(to_anystring<char32_t>(utf32_str) == str_utf32);
+    assert(to_string(compact_string(u"caf\u00e9"sv)) == "caf\u00e9"); // Latin-1 code points are not ASCII.
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void rope_support()
+{
+    using namespace sutf;
+
+    // edit large UTF-8 document by code point positions
+
+    rope<char> doc(str_char);
+
+    doc.insert(4, "\xe2\x9c\x85"sv); // insert code point at specified code point position.
+    doc.erase(0, 1); // erase code point range.
+
+    assert(doc.length() == 8); // number of code points in the document.
+    assert(doc.size() == 22); // number of UTF-8 code units in the document.
+    assert(doc.metrics().utf16_units == 10); // number of UTF-16 code units in the document.
+
+
+
+    // convert positions between code points, UTF-8 and UTF-16 code units
+
+    assert(doc.code_unit_offset<char>(3) == 9); // UTF-8 offset of the 4th code point.
+    assert(doc.code_unit_offset<char16_t>(3) == 4); // UTF-16 offset of the 4th code point.
+    assert(doc.code_point_offset<char16_t>(4) == 3); // code point at UTF-16 offset.
+
+
+
+    // get content of the document
+
+    assert(doc.substr(2, 2) == "\xf0\x9f\x98\x82\xe2\x9c\x85"sv);
+    assert(to_u16string(doc.str()) == u"\U000000a9\U00002190\U0001f602\U00002705\U00000042\U000000ae\U00002705\U0001f973"sv);
+
+
+
+    // moved from document stays valid and empty
+
+    rope<char> moved_doc(std::move(doc));
+
+    assert(moved_doc.length() == 8 && doc.empty()); // moved from document has no content.
+    doc.append("abc"sv);
+    assert(doc.str() == "abc");
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void conversion_cache_support()
+{
+    using namespace sutf;
+
+    // cache results of frequent conversions
+
+    wstring_cache<char> cache(1024); // thread safe cache for 1024 UTF-8 to UTF-16/UTF-32 conversions.
+
+    const auto first = to_wstring(str_char, cache); // convert and store the result.
+    const auto second = to_wstring(str_char, cache); // get stored result without conversion.
+
+    assert(*first == str_wchar && first == second);
+    assert(cache.stats().hits == 1 && cache.stats().misses == 1);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void latin1_support()
+{
+    using namespace sutf;
+
+    // convert Latin-1 string to any UTF string
+
+    const auto str_latin1 = latin1_view("\x41\xa9\x42\xae"sv); // Latin-1 string 'A©B®'.
+
+    assert(to_string(str_latin1) == "\x41\xc2\xa9\x42\xc2\xae"sv);
+    assert(to_u16string(str_latin1) == u"\U00000041\U000000a9\U00000042\U000000ae"sv);
+    assert(code_point_count(str_latin1) == 4); // Latin-1 strings are accepted by low level routines too.
+
+
+
+    // convert any UTF string to Latin-1 string
+
+    assert(to_latin1(u"\U00000041\U000000a9"sv) == "\x41\xa9"sv);
+    assert(to_latin1(str_utf32, '?') == "\x41\xa9??\x42\xae??"sv); // replace code points out of Latin-1 range.
+
+    try {
+
+        to_latin1(str_utf32); // code points out of Latin-1 range can't be converted.
+        assert(false);
+
+    } catch (const std::range_error&) {
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void byte_order_support()
+{
+    using namespace sutf;
+
+    // convert UTF-16/UTF-32 string with explicit byte order to any UTF string
+
+    const auto str_utf16be = utf16be_view("\x00\x41\x00\xa9\xd8\x3d\xde\x02"sv); // UTF-16BE string 'A©😂'.
+
+    assert(to_string(str_utf16be) == "\x41\xc2\xa9\xf0\x9f\x98\x82"sv);
+    assert(to_u32string(str_utf16be) == U"\U00000041\U000000a9\U0001f602"sv);
+    assert(code_point_count(str_utf16be) == 3); // byte ordered strings are accepted by low level routines too.
+
+    std::vector<char> unpaired_utf8(6); // unpaired high surrogate is kept as separate code point.
+    assert(convert(utf16le_view("\x00\xd8\x2d\x4e"sv), unpaired_utf8) == 6);
+    assert(std::string_view(unpaired_utf8.data(), 6) == "\xed\xa0\x80\xe4\xb8\xad"sv);
+
+
+
+    // convert any UTF string to UTF-16/UTF-32 string with explicit byte order
+
+    assert(to_utf16le(u8"\U00000041\U0001f602"sv) == "\x41\x00\x3d\xd8\x02\xde"sv);
+    assert(to_utf32be(str_utf16) == to_utf32be(str_utf8));
+    assert(to_u16string(utf32le_view(to_utf32le(str_utf16))) == str_utf16);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void encoding_detection_support()
+{
+    using namespace sutf;
+
+    // detect encoding by byte order mark
+
+    const detection bom = detect_encoding("\xff\xfe\x41\x00"sv);
+
+    assert(bom.type == encoding::utf16le && bom.bom_size == 2 && bom.confidence == 1);
+
+
+
+    // detect encoding by content
+
+    assert(detect_encoding(to_string(str_utf32)).type == encoding::utf8);
+    assert(detect_encoding(to_utf16be(str_utf32)).type == encoding::utf16be);
+    assert(detect_encoding(to_utf32le(str_utf32)).type == encoding::utf32le);
+    assert(detect_encoding("\x41\xa9\x42\xae"sv).type == encoding::latin1); // not valid UTF-8 string.
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void comparison_support()
+{
+    using namespace sutf;
+
+    // compare strings of different encodings without conversion
+
+    assert(sutf::equal(str_utf8, str_utf16));
+    assert(sutf::equal(str_utf16, utf16be_view(to_utf16be(str_utf32))));
+    assert(sutf::compare(str_utf8, str_utf32) == 0);
+    assert(sutf::compare(u8"\U0000ffff"sv, u"\U00010000"sv) < 0); // code point order, not UTF-16 code unit order.
+    assert(sutf::compare(u"\U0000ffff"sv, u"\U00010000"sv) < 0);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void hash_support()
+{
+    using namespace sutf;
+
+    // hash of code points doesn't depend on encoding
+
+    assert(hash_code_points(str_utf8) == hash_code_points(str_utf16));
+    assert(sutf::hash()(str_utf32) == sutf::hash()(raw_wchar));
+
+
+
+    // query container keyed by UTF-8 strings with string of other encoding without conversion
+
+#if defined(__cpp_lib_generic_unordered_lookup)
+    std::unordered_map<std::string, int, sutf::hash, sutf::equal_to> map = { { to_string(str_utf8), 1 } };
+
+    assert(map.find(str_utf16) != map.end());
+    assert(map.count(u"\U00000041"sv) == 0);
+#endif // __cpp_lib_generic_unordered_lookup
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void search_support()
+{
+    using namespace sutf;
+
+    // find UTF-16 needle in UTF-8 haystack
+
+    uint_t cp_offset = 0;
+
+    assert(sutf::find(str_utf8, u"\U00000042\U000000ae"sv) == 10); // code unit offset.
+    assert(sutf::find(str_utf8, u"\U00000042\U000000ae"sv, cp_offset) == 10 && cp_offset == 4); // code point offset.
+    assert(sutf::find(str_utf16, U"\U0001f973"sv) == 8);
+    assert(sutf::find(str_utf32, "\x42\xc2\xaf"sv) == npos);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void truncation_support()
+{
+    using namespace sutf;
+
+    // skip code points and truncate strings without splitting code points
+
+    assert(code_point_advance(str_utf8.data(), str_utf8.data() + str_utf8.size(), 5) == str_utf8.data() + 11);
+    assert(truncate_to_code_points(str_utf8, 3) == str_utf8.substr(0, 6));
+    assert(truncate_to_code_points(str_utf16, 100) == str_utf16);
+    assert(truncate_to_code_units(str_utf8, 8) == str_utf8.substr(0, 6)); // code point U+1f602 doesn't fit.
+    assert(truncate_to_code_units(str_utf16, 4) == str_utf16.substr(0, 3)); // surrogate pair isn't split.
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void measurement_support()
+{
+    using namespace sutf;
+
+    // measure lengths in every encoding in one pass
+
+    const measurement lengths = measure(str_utf16);
+
+    assert(lengths.code_points == 8);
+    assert(lengths.utf8_size == str_utf8.size());
+    assert(lengths.utf16_size == str_utf16.size());
+    assert(lengths.utf32_size == str_utf32.size());
+    assert(!lengths.ascii);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void stream_support()
+{
+    using namespace sutf;
+
+    // read UTF-8 stream as UTF-16 stream
+
+    std::stringbuf utf8_input { std::string(str_char) };
+    transcoding_streambuf<char, char16_t> utf16_input(&utf8_input);
+    std::basic_istream<char16_t> in(&utf16_input);
+
+    std::u16string read_str(str_utf16.size(), 0);
+    in.read(read_str.data(), read_str.size());
+    assert(read_str == str_utf16);
+
+    // write UTF-32 stream as UTF-8 stream
+
+    std::stringbuf utf8_output;
+    {
+        transcoding_streambuf<char, char32_t> utf32_output(&utf8_output);
+        std::basic_ostream<char32_t>(&utf32_output).write(str_utf32.data(), str_utf32.size());
+    }
+    assert(utf8_output.str() == str_char);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void pipeline_support()
+{
+    using namespace sutf;
+
+    // transcode UTF-8 source to UTF-16 by concurrent stages in tiny blocks
+
+    pipeline_options options;
+    options.block_size = 5;
+    options.workers = 2;
+
+    uint_t read_size = 0;
+    u16string write_str;
+
+    const pipeline_statistics stats = transcode_pipeline<char, char16_t>(
+        [&](char* buffer, uint_t size) {
+            size = std::min(size, str_char.size() - read_size);
+            read_size += str_char.copy(buffer, size, read_size);
+            return size;
+        },
+        [&](const char16_t* buffer, uint_t size) {
+            write_str.append(buffer, size);
+        },
+        options);
+
+    assert(write_str == str_utf16);
+    assert(stats.read.bytes == str_char.size() && stats.write.bytes == str_utf16.size() * sizeof(char16_t));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void scratch_support()
+{
+    using namespace sutf;
+
+    // convert to thread local buffer, the view is valid until the next call
+
+    const u16string_view scratch_str = to_scratch<char16_t>(str_utf8);
+    assert(scratch_str == str_utf16);
+
+    // several converted strings at once
+
+    const scratch_lease<char> lease1 = lease_scratch<char>(str_utf16);
+    const scratch_lease<char> lease2 = lease_scratch<char>(str_utf32);
+    assert(lease1.view() == str_char && lease2.view() == str_char);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void instrumentation_support()
+{
+    using namespace sutf;
+
+    // counters of conversions are collected if SUTF_INSTRUMENTATION is defined
+
+    const instrumentation_snapshot before = snapshot_instrumentation();
+    const u16string utf16_str = to_u16string(str_utf8);
+    const instrumentation_snapshot after = snapshot_instrumentation();
+
+    const conversion_statistics& calls_before = before.conversion<char8s_t, char16_t>();
+    const conversion_statistics& calls_after = after.conversion<char8s_t, char16_t>();
+
+#if defined(SUTF_INSTRUMENTATION)
+    assert(calls_after.calls - calls_before.calls == 1);
+    assert(after.code_point_widths[3] - before.code_point_widths[3] == 2); // two 4 byte code points.
+#else
+    assert(calls_after.calls == 0 && calls_before.calls == 0);
+#endif // SUTF_INSTRUMENTATION
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void json_support()
+{
+    using namespace sutf;
+
+    // escape for JSON string, optionally with ASCII only output
+
+    const std::string escaped_str = json_escape<char>(std::string_view("\"A\"\n"));
+    assert(escaped_str == "\\\"A\\\"\\n");
+
+    const std::string ascii_str = json_escape<char>(str_utf16, json_escape_mode::ascii);
+    assert(ascii_str == "A\\u00a9\\u2190\\ud83d\\ude02B\\u00ae\\u2705\\ud83e\\udd73");
+
+    // unescape joins surrogate pairs
+
+    const u16string unescaped_str = json_unescape<char16_t>(ascii_str);
+    assert(unescaped_str == str_utf16);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void property_support()
+{
+    using namespace sutf;
+
+    // properties of single code point
+
+    static_assert(is_letter(U'ю') && is_digit(U'٣') && is_whitespace(U'\u3000'));
+    static_assert(code_point_category(U'©') == general_category::other_symbol);
+
+    // classify all code points of string at once
+
+    std::uint64_t bitmap[1];
+    const uint_t count = classify(str_utf8, code_point_property::letter, bitmap);
+    assert(count == 8 && bitmap[0] == 0b00010001);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void case_folding_support()
+{
+    using namespace sutf;
+
+    // case insensitive comparison of strings in different encodings
+
+    assert(equal_ignore_case(std::string_view("Straße"), std::u16string_view(u"STRAẞE")));
+    assert(hash_ignore_case(std::string_view("Straße")) == hash_ignore_case(std::u16string_view(u"STRAẞE")));
+    assert(case_fold<char>(std::u16string_view(u"ΣΊΣΥΦΟΣ")) == "σίσυφοσ");
+
+    // case insensitive set
+
+    const std::unordered_set<std::string, ignore_case_hash, ignore_case_equal_to> names = { "Alice", "Bob" };
+    assert(names.count("ALICE") == 1);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void normalization_support()
+{
+    using namespace sutf;
+
+    // already normalized string is checked by one scan
+
+    std::string nfc_str;
+    assert(is_nfc_quick(str_utf8) == quick_check::yes);
+    assert(!normalize_nfc(str_utf8, nfc_str) && nfc_str.empty());
+
+    // decomposed characters are composed
+
+    assert(is_nfc_quick(std::string_view("e\u0301")) == quick_check::maybe);
+    assert(normalize_nfc(std::string_view("Cafe\u0301"), nfc_str) && nfc_str == "Caf\u00e9");
+    assert(to_nfc<char16_t>(std::string_view("\u1100\u1161\u11a8")) == u"\uac01");
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void grapheme_support()
+{
+    using namespace sutf;
+
+    // family emoji is one grapheme cluster of five code points
+
+    const std::u16string_view family_str = u"a\U0001F468\u200D\U0001F469\u200D\U0001F467e\u0301";
+    uint_t cluster_count = 0;
+
+    for (const std::u16string_view cluster : graphemes(family_str))
+        cluster_count += !cluster.empty();
+
+    assert(cluster_count == 3 && grapheme_count(family_str) == 3);
+
+    // display width in terminal columns and truncation to the width
+
+    assert(display_width(family_str) == 4);
+    assert(display_width(str_utf8) == 11);
+    assert(truncate_to_width(std::string_view("ab\u4e2d\u6587"), 5) == "ab\u4e2d");
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void split_support()
+{
+    using namespace sutf;
+
+    // runs of Unicode whitespace including no-break and ideographic spaces separate tokens
+
+    const std::string_view words_str = " alpha\u00A0beta\u3000\u3000gamma\n";
+    std::vector<std::string_view> words;
+
+    for (const std::string_view word : split(words_str))
+        words.push_back(word);
+
+    assert((words == std::vector<std::string_view> { "alpha", "beta", "gamma" }));
+
+    // every delimiter code point separates tokens, empty tokens are kept
+
+    uint_t field_count = 0;
+
+    for (const std::u16string_view field : split(std::u16string_view(u"a,b\u3001\u3001c"), u",\u3001"))
+        field_count += field.size() <= 1;
+
+    assert(field_count == 4);
+
+    // empty string is one empty field
+
+    const auto empty_fields = split(std::string_view(), ",");
+    assert(std::distance(empty_fields.begin(), empty_fields.end()) == 1 && (*empty_fields.begin()).empty());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void edit_distance_support()
+{
+    using namespace sutf;
+
+    // distance in code points between strings of different encodings
+
+    assert(edit_distance("kitten", u"sitting") == 3);
+    assert(edit_distance(str_utf8, str_utf16) == 0);
+    assert(edit_distance(std::string_view("\U0001F602 smile"), std::u32string_view(U"\U0001F973 smile")) == 1);
+
+    // the distance over the maximum stops early
+
+    assert(edit_distance("fuzzy", "wuzzy", 2) == 1);
+    assert(edit_distance("fuzzy", "lorem ipsum", 2) == 3);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void sort_support()
+{
+    using namespace sutf;
+
+    // code point order puts supplementary characters after U+FFFD, unlike UTF-16 code unit order
+
+    std::vector<std::u16string> words = { u"\U0001F602", u"b", u"\uFFFD", u"a", u"" };
+    const std::vector<std::u16string> sorted_words = { u"", u"a", u"b", u"\uFFFD", u"\U0001F602" };
+
+    sort_strings(words);
+    assert(words == sorted_words);
+
+    // the sort is stable, views of equal strings keep their order
+
+    const std::string_view text = "pear apple pear";
+    std::vector<std::string_view> fruits = { text.substr(0, 4), text.substr(5, 5), text.substr(11, 4) };
+
+    sort_strings(fruits.begin(), fruits.end(), 2);
+    assert(fruits[0] == "apple" && fruits[1].data() == text.data() && fruits[2].data() == text.data() + 11);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void punycode_support()
+{
+    using namespace sutf;
+
+    // Punycode of single label from UTF-8 and UTF-16 strings
+
+    assert(punycode_encode<char>(std::string_view("b\u00FCcher")) == "bcher-kva");
+    assert(punycode_encode<char>(std::u16string_view(u"\u4E2D\u56FD")) == "fiqs8s");
+    assert(punycode_decode<char16_t>(std::string_view("bcher-kva")) == u"b\u00FCcher");
+
+    // domain names are converted label by label
+
+    assert(domain_to_ascii<char>(std::u16string_view(u"www.m\u00FCnchen.de")) == "www.xn--mnchen-3ya.de");
+    assert(domain_to_unicode<char>(std::string_view("www.xn--mnchen-3ya.de")) == "www.m\u00FCnchen.de");
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void segment_support()
+{
+    using namespace sutf;
+
+    // container of code units with non-contiguous storage
+
+    const std::deque<char16_t> units(std::cbegin(str_utf16), std::cend(str_utf16));
+    assert(convert_segments<char8s_t>(units) == str_utf8);
+
+    // chain of buffers, the emoji is split between the second and the third buffer
+
+    const std::vector<std::basic_string_view<char8s_t>> buffers = { str_utf8.substr(0, 3), str_utf8.substr(3, 5), str_utf8.substr(8) };
+    assert(convert_segments<char16_t>(buffers) == str_utf16);
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // module main entry point
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +828,31 @@ int main()
 {
     code_point_support();
     string_support();
+    compact_string_support();
+    rope_support();
+    conversion_cache_support();
+    latin1_support();
+    byte_order_support();
+    encoding_detection_support();
+    comparison_support();
+    hash_support();
+    search_support();
+    truncation_support();
+    measurement_support();
+    stream_support();
+    pipeline_support();
+    scratch_support();
+    instrumentation_support();
+    json_support();
+    property_support();
+    case_folding_support();
+    normalization_support();
+    grapheme_support();
+    split_support();
+    edit_distance_support();
+    sort_support();
+    punycode_support();
+    segment_support();
 
     return 1;
 }
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// benchmark of domain name conversion on generated hostname set, build and run with optimization:
+//
+//     g++ -std=c++17 -O2 examples/punycode_benchmark.cpp -o punycode_benchmark && ./punycode_benchmark
+//     cl /std:c++17 /O2 /EHsc examples\punycode_benchmark.cpp && punycode_benchmark.exe
+
+#include "../include/sutfcpplib/utf_string.h"
+#include "../include/sutfcpplib/utf_punycode.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constant data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// labels of generated hostnames, most of hostnames are ASCII, every fourth one has non-ASCII label
+
+constexpr const char* ascii_labels[] = { "www", "api", "cdn", "mail", "example", "shop", "static", "login" };
+constexpr const char* unicode_labels[] = { "m\xc3\xbc" "nchen", "b\xc3\xbc" "cher", "\xe4\xb8\xad\xe5\x9b\xbd", "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80",
+    "\xe4\xbe\x8b\xe3\x81\x88", "caf\xc3\xa9", "\xd9\x85\xd8\xab\xd8\xa7\xd9\x84", "\xf0\x9f\x98\x82" };
+constexpr const char* top_labels[] = { "com", "de", "org", "\xd1\x80\xd1\x84", "jp", "net" };
+
+constexpr std::size_t host_count = 1000000;
+constexpr int pass_count = 3;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// benchmark routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<std::string> make_hosts()
+{
+    // hostnames of form subdomain.domain.tld, the seed is fixed to get the same set on every run
+
+    std::mt19937 random(1);
+    std::vector<std::string> hosts;
+
+    hosts.reserve(host_count);
+
+    for (std::size_t index = 0; index != host_count; ++index) {
+
+        std::string host = ascii_labels[random() % std::size(ascii_labels)];
+
+        host += '.';
+        host += random() % 4 == 0 ? unicode_labels[random() % std::size(unicode_labels)] : ascii_labels[random() % std::size(ascii_labels)];
+        host += '.';
+        host += top_labels[random() % std::size(top_labels)];
+
+        hosts.push_back(std::move(host));
+    }
+
+    return hosts;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename func_t>
+static double measure(const std::vector<std::string>& hosts, func_t func)
+{
+    // nanoseconds per hostname
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const std::string& host : hosts)
+        func(host);
+
+    const auto finish = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() / hosts.size();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// module main entry point
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using namespace sutf;
+
+    const std::vector<std::string> hosts = make_hosts();
+
+    std::vector<std::string> encoded(hosts.size());
+    std::size_t checksum = 0;
+
+    for (int pass = 0; pass != pass_count; ++pass) {
+
+        std::size_t index = 0;
+
+        // UTF-32 round trip is the cost paid before Punycode by libraries working on code point arrays
+
+        const double to_ascii = measure(hosts, [&](const std::string& host) { encoded[index++] = domain_to_ascii<char>(host); });
+        const double to_unicode = measure(encoded, [&](const std::string& host) { checksum += domain_to_unicode<char>(host).size(); });
+        const double round_trip = measure(hosts, [&](const std::string& host) { checksum += to_string(to_u32string(host)).size(); });
+
+        std::printf("domain_to_ascii %.0f ns/host, domain_to_unicode %.0f ns/host, UTF-32 round trip %.0f ns/host\n", to_ascii, to_unicode, round_trip);
+    }
+
+    std::printf("%zu hostnames, checksum %zu\n", hosts.size(), checksum);
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of punycode_benchmark.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,780 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_string.h"
+#include "utf_simd.h"
+
+#include <algorithm>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline constexpr uint_t npos = static_cast<uint_t>(-1);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// hash
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// transparent hash of code point sequence, strings holding the same code points have the same
+// hash regardless of encoding, so that containers keyed by string of one encoding can be queried
+// by string of any other one
+
+struct hash
+{
+    using is_transparent = void;
+
+    template<typename type_t>
+    auto operator()(const type_t& str) const noexcept -> decltype(std::cbegin(str), uint_t());
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// equal_to
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// transparent equality of code point sequences, the pair for sutf::hash
+
+struct equal_to
+{
+    using is_transparent = void;
+
+    template<typename lhs_t, typename rhs_t>
+    auto operator()(const lhs_t& lhs, const rhs_t& rhs) const noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool());
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// measurement
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// lengths of string in code points and in code units of every encoding
+
+struct measurement
+{
+    uint_t code_points = 0;
+    uint_t utf8_size = 0;
+    uint_t utf16_size = 0;
+    uint_t utf32_size = 0;
+    bool ascii = true;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// code point order comparison of strings of any encodings, returns negative value, zero or
+// positive value if the left string is less, equal or greater than the right one
+
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int> = 0>
+int compare(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept;
+template<typename lhs_t, typename rhs_t>
+auto compare(const lhs_t& lhs, const rhs_t& rhs) noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), int());
+
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int> = 0>
+bool equal(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept;
+template<typename lhs_t, typename rhs_t>
+auto equal(const lhs_t& lhs, const rhs_t& rhs) noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// encoding independent hash of code points
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int> = 0>
+uint_t hash_code_points(it_t it, const it_t last) noexcept;
+template<typename type_t>
+auto hash_code_points(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// substring search in strings of any encodings, returns code unit offset of the needle in
+// the haystack or npos and optionally code point offset
+
+template<typename haystack_t, typename needle_t>
+auto find(const haystack_t& haystack, const needle_t& needle) -> decltype(std::cbegin(haystack), std::cbegin(needle), uint_t());
+template<typename haystack_t, typename needle_t>
+auto find(const haystack_t& haystack, const needle_t& needle, uint_t& cp_offset) -> decltype(std::cbegin(haystack), std::cbegin(needle), uint_t());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// lengths of string in every encoding measured in one pass
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int> = 0>
+measurement measure(it_t it, const it_t last) noexcept;
+template<typename type_t>
+auto measure(const type_t& str) noexcept -> decltype(std::cbegin(str), measurement());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// skipping of code points and truncation of contiguous strings without splitting code points,
+// truncated strings are views of the source strings
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int> = 0>
+it_t code_point_advance(it_t it, const it_t last, uint_t count) noexcept;
+
+template<typename type_t>
+auto truncate_to_code_points(const type_t& str, uint_t count) noexcept -> std::basic_string_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>;
+template<typename type_t>
+auto truncate_to_code_units(const type_t& str, uint_t size) noexcept -> std::basic_string_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename = void>
+constexpr bool is_contiguous_string_v = false;
+template<typename type_t>
+constexpr bool is_contiguous_string_v<type_t, std::void_t<decltype(std::data(std::declval<const type_t&>()))>> = std::is_same_v<
+    decltype(std::data(std::declval<const type_t&>())),
+    const typename std::iterator_traits<decltype(std::cbegin(std::declval<const type_t&>()))>::value_type*>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr auto code_units_of(const type_t& str) noexcept
+{
+    // pointers to code units of contiguous strings and iterators otherwise, native arrays are
+    // trimmed by terminating zero
+
+    if constexpr (is_char_array_v<type_t>)
+        return std::pair(std::data(str), std::data(str) + std::size(str) - 1);
+    else if constexpr (is_contiguous_string_v<type_t>)
+        return std::pair(std::data(str), std::data(str) + std::size(str));
+    else
+        return std::pair(std::cbegin(str), std::cend(str));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void append_units(std::basic_string<chardst_t>& out, const charsrc_t* it, const charsrc_t* last)
+{
+    // append code units converted to the encoding of the destination string
+
+    if constexpr (std::is_same_v<chardst_t, charsrc_t>) {
+
+        out.append(it, last - it);
+
+    } else {
+
+        const uint_t size = out.size();
+
+        out.resize(size + max_code_units<chardst_t, charsrc_t>(last - it));
+        out.resize(transcode(it, last, out.data() + size) - out.data());
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+constexpr uint_t code_point_order(uint_t unit) noexcept
+{
+    // UTF-16 code units greater than surrogates are moved below them, so that code unit order
+    // becomes code point order
+
+    if constexpr (sizeof(char_t) == sizeof(char16_t))
+        return unit >= 0xe000 ? unit - 0x800 : unit >= 0xd800 ? unit + 0x2000 : unit;
+    else
+        return unit;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itlhs_t, typename itrhs_t>
+inline int compare_code_points(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept
+{
+    using charlhs_t = typename std::iterator_traits<itlhs_t>::value_type;
+    using charrhs_t = typename std::iterator_traits<itrhs_t>::value_type;
+
+    if constexpr (std::is_pointer_v<itlhs_t> && std::is_pointer_v<itrhs_t> && sizeof(charlhs_t) == sizeof(charrhs_t)) {
+
+        // code unit order of UTF-8 and UTF-32 strings is code point order, UTF-16 code units are
+        // reordered at the first mismatch only
+
+        const uint_t lhs_size = lhs_last - lhs;
+        const uint_t rhs_size = rhs_last - rhs;
+        const uint_t size = std::min(lhs_size, rhs_size);
+        const uint_t index = unit_mismatch(reinterpret_cast<const unit_t<charlhs_t>*>(lhs), reinterpret_cast<const unit_t<charrhs_t>*>(rhs), size);
+
+        if (index == size)
+            return lhs_size < rhs_size ? -1 : lhs_size > rhs_size ? 1 : 0;
+
+        const uint_t lhs_unit = code_point_order<charlhs_t>(static_cast<unit_t<charlhs_t>>(lhs[index]));
+        const uint_t rhs_unit = code_point_order<charrhs_t>(static_cast<unit_t<charrhs_t>>(rhs[index]));
+
+        return lhs_unit < rhs_unit ? -1 : 1;
+
+    } else {
+
+        while (true) {
+
+            // skip common ASCII prefix in bulk and decode code points where strings diverge
+
+            if constexpr (std::is_pointer_v<itlhs_t> && std::is_pointer_v<itrhs_t>) {
+
+                const uint_t index = ascii_prefix(lhs, rhs, std::min<uint_t>(lhs_last - lhs, rhs_last - rhs));
+                lhs += index;
+                rhs += index;
+            }
+
+            if (lhs == lhs_last || rhs == rhs_last)
+                break;
+
+            const uint_t lhs_cp = code_point_read(lhs);
+            const uint_t rhs_cp = code_point_read(rhs);
+
+            if (lhs_cp != rhs_cp)
+                return lhs_cp < rhs_cp ? -1 : 1;
+
+            lhs = code_point_next(lhs);
+            rhs = code_point_next(rhs);
+        }
+
+        return (lhs != lhs_last) - (rhs != rhs_last);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itlhs_t, typename itrhs_t>
+inline bool equal_code_points(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept
+{
+    using charlhs_t = typename std::iterator_traits<itlhs_t>::value_type;
+    using charrhs_t = typename std::iterator_traits<itrhs_t>::value_type;
+
+    if constexpr (std::is_pointer_v<itlhs_t> && std::is_pointer_v<itrhs_t> && sizeof(charlhs_t) == sizeof(charrhs_t)) {
+
+        const uint_t size = lhs_last - lhs;
+
+        return static_cast<uint_t>(rhs_last - rhs) == size &&
+            unit_mismatch(reinterpret_cast<const unit_t<charlhs_t>*>(lhs), reinterpret_cast<const unit_t<charrhs_t>*>(rhs), size) == size;
+
+    } else {
+
+        return compare_code_points(lhs, lhs_last, rhs, rhs_last) == 0;
+    }
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class code_point_hasher
+{
+    // hash of UTF-8 representation of code points, the bytes are gathered in 64-bit words,
+    // every word is mixed as MurmurHash3 block
+
+public:
+    void append(std::uint64_t bytes, uint_t size) noexcept
+    {
+        // append up to 8 bytes stored in little endian order
+
+        m_word |= bytes << m_bits;
+        m_bits += size * 8;
+        m_size += size;
+
+        if (m_bits >= 64) {
+
+            mix(m_word);
+            m_bits -= 64;
+            m_word = m_bits != 0 ? bytes >> (size * 8 - m_bits) : 0;
+        }
+    }
+
+    void append_bytes(const char* it, uint_t size) noexcept
+    {
+        for (; size >= 8; size -= 8, it += 8)
+            append(load(it), 8);
+
+        std::uint64_t word = 0;
+
+        for (uint_t index = 0; index != size; ++index)
+            word |= std::uint64_t(static_cast<unsigned char>(it[index])) << (index * 8);
+
+        append(word, size);
+    }
+
+    void append_words(const char* it, uint_t count) noexcept
+    {
+        for (; count != 0; --count, it += 8) {
+
+            mix(load(it));
+            m_size += 8;
+        }
+    }
+
+    uint_t finish() noexcept
+    {
+        std::uint64_t hash = m_hash ^ mix_block(m_word) ^ m_size;
+
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccd;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53;
+        hash ^= hash >> 33;
+
+        return static_cast<uint_t>(hash);
+    }
+
+    static std::uint64_t load(const char* it) noexcept
+    {
+        std::uint64_t word;
+        std::memcpy(&word, it, sizeof(word));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+
+        return word;
+    }
+
+private:
+    static std::uint64_t rotate(std::uint64_t value, uint_t shift) noexcept
+    {
+        return value << shift | value >> (64 - shift);
+    }
+
+    static std::uint64_t mix_block(std::uint64_t word) noexcept
+    {
+        return rotate(word * 0x87c37b91114253d5, 31) * 0x4cf5ad432745937f;
+    }
+
+    void mix(std::uint64_t word) noexcept
+    {
+        m_hash = rotate(m_hash ^ mix_block(word), 27) * 5 + 0x52dce729;
+    }
+
+private:
+    std::uint64_t m_hash = 0;
+    std::uint64_t m_word = 0;
+    uint_t m_bits = 0;
+    uint_t m_size = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline uint_t hash_code_points(it_t it, const it_t last) noexcept
+{
+    using char_t = typename std::iterator_traits<it_t>::value_type;
+
+    code_point_hasher hasher;
+
+    if constexpr (std::is_pointer_v<it_t> && sizeof(char_t) == 1) {
+
+        // UTF-8 string is the hashed representation itself
+
+        const uint_t count = (last - it) / 8;
+        hasher.append_words(reinterpret_cast<const char*>(it), count);
+        it += count * 8;
+
+        std::uint64_t word = 0;
+
+        for (uint_t index = 0; it + index != last; ++index)
+            word |= std::uint64_t(static_cast<unit_t<char_t>>(it[index])) << (index * 8);
+
+        hasher.append(word, last - it);
+        return hasher.finish();
+
+    } else if constexpr (std::is_pointer_v<it_t>) {
+
+        // ASCII blocks of wide strings are narrowed in registers, the rest is encoded to UTF-8
+        // by chunks
+
+        constexpr uint_t chunk_size = 64;
+        char buffer[(chunk_size + 1) * 4];
+
+        while (it != last) {
+
+#if defined(SUTF_SIMD_SSE2)
+            for (; last - it >= 8; it += 8) {
+
+                __m128i bytes;
+
+                if constexpr (sizeof(char_t) == 2) {
+
+                    const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xff80))), _mm_setzero_si128())) != 0xffff)
+                        break;
+
+                    bytes = _mm_packus_epi16(units, units);
+
+                } else {
+
+                    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+                    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 4));
+                    const __m128i high = _mm_and_si128(_mm_or_si128(lo, hi), _mm_set1_epi32(static_cast<int>(0xffffff80)));
+
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xffff)
+                        break;
+
+                    const __m128i units = _mm_packs_epi32(lo, hi);
+                    bytes = _mm_packus_epi16(units, units);
+                }
+
+                alignas(16) std::uint64_t word[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(word), bytes);
+                hasher.append(word[0], 8);
+            }
+
+            if (it == last)
+                break;
+#endif // SUTF_SIMD_SSE2
+
+            // encode the chunk starting with non-ASCII characters on the stack, the chunk doesn't
+            // split pairs of surrogates
+
+            it_t chunk = it + std::min<uint_t>(last - it, chunk_size);
+
+            if constexpr (sizeof(char_t) == sizeof(char16_t)) {
+                if (chunk != last && (static_cast<uint_t>(chunk[-1]) & 0xfc00) == 0xd800)
+                    ++chunk;
+            }
+
+            char* const end = code_point_convert(it, chunk, buffer);
+            hasher.append_bytes(buffer, end - buffer);
+            it = chunk;
+        }
+    }
+
+    for (; it != last; it = code_point_next(it)) {
+
+        char buffer[4];
+        hasher.append_bytes(buffer, code_point_write(buffer, code_point_read(it)) - buffer);
+    }
+
+    return hasher.finish();
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename ithaystack_t, typename itneedle_t>
+inline uint_t find_code_units(const ithaystack_t first, const ithaystack_t last, const itneedle_t needle, const itneedle_t needle_last)
+{
+    // the needle is converted to the haystack encoding unless both have the same code unit width,
+    // a match of valid needle always starts at code point boundary
+
+    using charhaystack_t = typename std::iterator_traits<ithaystack_t>::value_type;
+    using charneedle_t = typename std::iterator_traits<itneedle_t>::value_type;
+
+    if constexpr (std::is_pointer_v<ithaystack_t> && std::is_pointer_v<itneedle_t> && sizeof(charhaystack_t) == sizeof(charneedle_t)) {
+
+        using unit_type = const unit_t<charhaystack_t>*;
+
+        const auto found = unit_search(reinterpret_cast<unit_type>(first), reinterpret_cast<unit_type>(last), reinterpret_cast<unit_type>(needle), needle_last - needle);
+        return found != reinterpret_cast<unit_type>(last) || needle == needle_last ? found - reinterpret_cast<unit_type>(first) : npos;
+
+    } else if constexpr (std::is_pointer_v<ithaystack_t>) {
+
+        const std::basic_string<charhaystack_t> converted = to_anystring<charhaystack_t>(needle, needle_last);
+        return find_code_units(first, last, converted.data(), converted.data() + converted.size());
+
+    } else {
+
+        const std::basic_string<charhaystack_t> converted = to_anystring<charhaystack_t>(needle, needle_last);
+        const auto found = std::search(first, last, converted.cbegin(), converted.cend());
+
+        return found != last || converted.empty() ? found - first : npos;
+    }
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// code point order comparison
+
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int>>
+inline int compare(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept
+{
+    return impl::compare_code_points(lhs, lhs_last, rhs, rhs_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename lhs_t, typename rhs_t>
+inline auto compare(const lhs_t& lhs, const rhs_t& rhs) noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), int())
+{
+    const auto [lhs_first, lhs_last] = impl::code_units_of(lhs);
+    const auto [rhs_first, rhs_last] = impl::code_units_of(rhs);
+
+    return impl::compare_code_points(lhs_first, lhs_last, rhs_first, rhs_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int>>
+inline bool equal(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept
+{
+    return impl::equal_code_points(lhs, lhs_last, rhs, rhs_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename lhs_t, typename rhs_t>
+inline auto equal(const lhs_t& lhs, const rhs_t& rhs) noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool())
+{
+    const auto [lhs_first, lhs_last] = impl::code_units_of(lhs);
+    const auto [rhs_first, rhs_last] = impl::code_units_of(rhs);
+
+    return impl::equal_code_points(lhs_first, lhs_last, rhs_first, rhs_last);
+}
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// encoding independent hash of code points
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
+inline uint_t hash_code_points(it_t it, const it_t last) noexcept
+{
+    return impl::hash_code_points(it, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto hash_code_points(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t())
+{
+    const auto [first, last] = impl::code_units_of(str);
+
+    return impl::hash_code_points(first, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// substring search
+
+template<typename haystack_t, typename needle_t>
+inline auto find(const haystack_t& haystack, const needle_t& needle) -> decltype(std::cbegin(haystack), std::cbegin(needle), uint_t())
+{
+    const auto [first, last] = impl::code_units_of(haystack);
+    const auto [needle_first, needle_last] = impl::code_units_of(needle);
+
+    return impl::find_code_units(first, last, needle_first, needle_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename haystack_t, typename needle_t>
+inline auto find(const haystack_t& haystack, const needle_t& needle, uint_t& cp_offset) -> decltype(std::cbegin(haystack), std::cbegin(needle), uint_t())
+{
+    const auto [first, last] = impl::code_units_of(haystack);
+    const auto [needle_first, needle_last] = impl::code_units_of(needle);
+    const uint_t offset = impl::find_code_units(first, last, needle_first, needle_last);
+
+    if (offset == npos)
+        cp_offset = npos;
+    else if constexpr (std::is_pointer_v<std::remove_const_t<decltype(first)>>)
+        cp_offset = offset - impl::continuation_count(first, first + offset);
+    else
+        cp_offset = code_point_count(first, first + offset);
+
+    return offset;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// measurement
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
+inline measurement measure(it_t it, const it_t last) noexcept
+{
+    measurement result;
+
+    if constexpr (std::is_pointer_v<it_t>) {
+
+        const impl::unit_lengths lengths = impl::measure_units(it, last);
+
+        result.code_points = lengths.code_points;
+        result.utf8_size = lengths.utf8_size;
+        result.utf16_size = lengths.utf16_size;
+        result.ascii = lengths.non_ascii == 0;
+
+    } else {
+
+        for (; last - it > 0; it = code_point_next(it)) {
+
+            const uint_t cp = code_point_read(it);
+
+            ++result.code_points;
+            result.utf8_size += code_unit_count<char>(cp);
+            result.utf16_size += code_unit_count<char16_t>(cp);
+            result.ascii &= cp < 0x80;
+        }
+    }
+
+    result.utf32_size = result.code_points;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto measure(const type_t& str) noexcept -> decltype(std::cbegin(str), measurement())
+{
+    const auto [first, last] = impl::code_units_of(str);
+
+    return measure(first, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// code point skipping and truncation
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
+inline it_t code_point_advance(it_t it, const it_t last, uint_t count) noexcept
+{
+    if constexpr (std::is_pointer_v<it_t>) {
+
+        return it + (impl::code_point_skip(it, last, count) - it);
+
+    } else {
+
+        for (; count != 0 && last - it > 0; --count)
+            it = code_point_next(it);
+
+        // truncated code point at the end may step over the end
+
+        return last - it < 0 ? last : it;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto truncate_to_code_points(const type_t& str, uint_t count) noexcept -> std::basic_string_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be truncated.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    return { first, static_cast<uint_t>(impl::code_point_skip(first, last, count) - first) };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto truncate_to_code_units(const type_t& str, uint_t size) noexcept -> std::basic_string_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be truncated.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    using char_t = std::remove_cv_t<std::remove_pointer_t<decltype(first)>>;
+
+    if (size >= static_cast<uint_t>(last - first))
+        return { first, static_cast<uint_t>(last - first) };
+
+    // step back over continuation units of the code point split by the budget
+
+    if constexpr (sizeof(char_t) == 1) {
+
+        while (size != 0 && (static_cast<impl::unit_t<char_t>>(first[size]) & 0xc0) == 0x80)
+            --size;
+
+    } else if constexpr (sizeof(char_t) == 2) {
+
+        if (size != 0 && (static_cast<impl::unit_t<char_t>>(first[size]) & 0xfc00) == 0xdc00)
+            --size;
+    }
+
+    return { first, size };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// hash
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+inline auto hash::operator()(const type_t& str) const noexcept -> decltype(std::cbegin(str), uint_t())
+{
+    return hash_code_points(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// equal_to
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename lhs_t, typename rhs_t>
+inline auto equal_to::operator()(const lhs_t& lhs, const rhs_t& rhs) const noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool())
+{
+    return sutf::equal(lhs, rhs);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_algorithm.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,358 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_string.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// conversion_cache
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// bounded thread safe cache of converted strings, the cache is split into independently locked
+// shards, every shard evicts entries using CLOCK algorithm
+
+template<typename chardst_t, typename charsrc_t = char>
+class conversion_cache
+{
+public:
+    using key_type = std::basic_string_view<charsrc_t>;
+    using value_type = std::shared_ptr<const std::basic_string<chardst_t>>;
+
+    struct statistics
+    {
+        uint_t hits = 0;
+        uint_t misses = 0;
+        uint_t evictions = 0;
+        uint_t size = 0;
+    };
+
+public:
+    explicit conversion_cache(uint_t capacity = 4096, uint_t shards = 16, uint_t max_key_size = 256);
+    conversion_cache(const conversion_cache&) = delete;
+    conversion_cache& operator=(const conversion_cache&) = delete;
+
+    value_type get(const key_type& src);
+    value_type find(const key_type& src) const;
+    void clear();
+
+    uint_t capacity() const noexcept;
+    statistics stats() const noexcept;
+
+private:
+    struct entry
+    {
+        std::basic_string<charsrc_t> key;
+        std::basic_string<chardst_t> value;
+    };
+
+    struct slot
+    {
+        std::shared_ptr<const entry> data;
+        mutable std::atomic<bool> referenced { false };
+    };
+
+    struct key_hash
+    {
+        uint_t operator()(const key_type& key) const noexcept;
+    };
+
+    struct shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<key_type, uint_t, key_hash> index;
+        std::vector<slot> slots;
+        uint_t hand = 0;
+        std::atomic<uint_t> size { 0 };
+        std::atomic<uint_t> hits { 0 };
+        std::atomic<uint_t> misses { 0 };
+        std::atomic<uint_t> evictions { 0 };
+    };
+
+    shard& select(const key_type& src) const noexcept;
+    static value_type lookup(const shard& part, const key_type& src);
+
+private:
+    std::unique_ptr<shard[]> m_shards;
+    uint_t m_shard_count;
+    uint_t m_max_key_size;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename charsrc_t>
+using wstring_cache = conversion_cache<wchar_t, charsrc_t>;
+template<typename charsrc_t>
+using u16string_cache = conversion_cache<char16_t, charsrc_t>;
+
+template<typename charsrc_t>
+std::shared_ptr<const wstring> to_wstring(const std::basic_string_view<charsrc_t>& str, conversion_cache<wchar_t, charsrc_t>& cache);
+template<typename charsrc_t>
+std::shared_ptr<const u16string> to_u16string(const std::basic_string_view<charsrc_t>& str, conversion_cache<char16_t, charsrc_t>& cache);
+template<typename chardst_t, typename charsrc_t>
+std::shared_ptr<const std::basic_string<chardst_t>> to_anystring(const std::basic_string_view<charsrc_t>& str, conversion_cache<chardst_t, charsrc_t>& cache);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// conversion_cache
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename chardst_t, typename charsrc_t>
+inline conversion_cache<chardst_t, charsrc_t>::conversion_cache(uint_t capacity, uint_t shards, uint_t max_key_size)
+    : m_shards(std::make_unique<shard[]>(std::max<uint_t>(shards, 1)))
+    , m_shard_count(std::max<uint_t>(shards, 1))
+    , m_max_key_size(max_key_size)
+{
+    const uint_t shard_capacity = std::max<uint_t>((capacity + m_shard_count - 1) / m_shard_count, 1);
+
+    for (uint_t index = 0; index != m_shard_count; ++index) {
+
+        m_shards[index].slots = std::vector<slot>(shard_capacity);
+        m_shards[index].index.reserve(shard_capacity);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline typename conversion_cache<chardst_t, charsrc_t>::value_type conversion_cache<chardst_t, charsrc_t>::get(const key_type& src)
+{
+    // long strings are converted bypassing the cache
+
+    if (src.size() > m_max_key_size)
+        return std::make_shared<const std::basic_string<chardst_t>>(sutf::to_anystring<chardst_t>(src));
+
+    shard& part = select(src);
+
+    if (value_type value = lookup(part, src)) {
+
+        part.hits.fetch_add(1, std::memory_order_relaxed);
+        return value;
+    }
+
+    part.misses.fetch_add(1, std::memory_order_relaxed);
+
+    // convert outside of the lock, concurrent misses of the same key keep the first stored result
+
+    auto data = std::make_shared<entry>();
+    data->key.assign(src.data(), src.size());
+    data->value = sutf::to_anystring<chardst_t>(src);
+
+    const std::unique_lock lock(part.mutex);
+
+    if (const auto found = part.index.find(src); found != part.index.end()) {
+
+        const std::shared_ptr<const entry>& stored = part.slots[found->second].data;
+        return value_type(stored, &stored->value);
+    }
+
+    // advance the clock hand to the first entry without reference bit, clearing the bits on the way
+
+    const uint_t size = part.slots.size();
+
+    while (part.slots[part.hand].referenced.exchange(false, std::memory_order_relaxed))
+        part.hand = (part.hand + 1) % size;
+
+    slot& victim = part.slots[part.hand];
+    part.hand = (part.hand + 1) % size;
+
+    if (victim.data) {
+
+        part.index.erase(victim.data->key);
+        part.evictions.fetch_add(1, std::memory_order_relaxed);
+
+    } else {
+
+        part.size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    victim.data = std::move(data);
+    part.index.emplace(victim.data->key, &victim - part.slots.data());
+
+    return value_type(victim.data, &victim.data->value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline typename conversion_cache<chardst_t, charsrc_t>::value_type conversion_cache<chardst_t, charsrc_t>::find(const key_type& src) const
+{
+    if (src.size() > m_max_key_size)
+        return value_type();
+
+    return lookup(select(src), src);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void conversion_cache<chardst_t, charsrc_t>::clear()
+{
+    for (uint_t index = 0; index != m_shard_count; ++index) {
+
+        shard& part = m_shards[index];
+        const std::unique_lock lock(part.mutex);
+
+        part.index.clear();
+        part.size.store(0, std::memory_order_relaxed);
+
+        for (slot& item : part.slots) {
+
+            item.data.reset();
+            item.referenced.store(false, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline uint_t conversion_cache<chardst_t, charsrc_t>::capacity() const noexcept
+{
+    return m_shards[0].slots.size() * m_shard_count;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline typename conversion_cache<chardst_t, charsrc_t>::statistics conversion_cache<chardst_t, charsrc_t>::stats() const noexcept
+{
+    statistics result;
+
+    for (uint_t index = 0; index != m_shard_count; ++index) {
+
+        const shard& part = m_shards[index];
+
+        result.size += part.size.load(std::memory_order_relaxed);
+        result.hits += part.hits.load(std::memory_order_relaxed);
+        result.misses += part.misses.load(std::memory_order_relaxed);
+        result.evictions += part.evictions.load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline uint_t conversion_cache<chardst_t, charsrc_t>::key_hash::operator()(const key_type& key) const noexcept
+{
+    // hash source bytes, so that the hash doesn't depend on std::hash support of the character type
+
+    return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(key.data()), key.size() * sizeof(charsrc_t)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline typename conversion_cache<chardst_t, charsrc_t>::shard& conversion_cache<chardst_t, charsrc_t>::select(const key_type& src) const noexcept
+{
+    const uint_t hash = key_hash()(src);
+
+    return m_shards[(hash ^ (hash >> 17)) % m_shard_count];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline typename conversion_cache<chardst_t, charsrc_t>::value_type conversion_cache<chardst_t, charsrc_t>::lookup(const shard& part, const key_type& src)
+{
+    const std::shared_lock lock(part.mutex);
+    const auto found = part.index.find(src);
+
+    if (found == part.index.end())
+        return value_type();
+
+    const slot& item = part.slots[found->second];
+    item.referenced.store(true, std::memory_order_relaxed);
+
+    return value_type(item.data, &item.data->value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename charsrc_t>
+inline std::shared_ptr<const wstring> to_wstring(const std::basic_string_view<charsrc_t>& str, conversion_cache<wchar_t, charsrc_t>& cache)
+{
+    return cache.get(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t>
+inline std::shared_ptr<const u16string> to_u16string(const std::basic_string_view<charsrc_t>& str, conversion_cache<char16_t, charsrc_t>& cache)
+{
+    return cache.get(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline std::shared_ptr<const std::basic_string<chardst_t>> to_anystring(const std::basic_string_view<charsrc_t>& str, conversion_cache<chardst_t, charsrc_t>& cache)
+{
+    return cache.get(str);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_cache.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
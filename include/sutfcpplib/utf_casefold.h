@@ -0,0 +1,427 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+#include "utf_unicode_tables.h"
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ignore_case_hash
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// transparent hash of case folded code point sequence, strings which differ only by letter case
+// have the same hash regardless of encoding
+
+struct ignore_case_hash
+{
+    using is_transparent = void;
+
+    template<typename type_t>
+    auto operator()(const type_t& str) const noexcept -> decltype(std::cbegin(str), uint_t());
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ignore_case_equal_to
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// transparent case insensitive equality of code point sequences, the pair for ignore_case_hash
+
+struct ignore_case_equal_to
+{
+    using is_transparent = void;
+
+    template<typename lhs_t, typename rhs_t>
+    auto operator()(const lhs_t& lhs, const rhs_t& rhs) const noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool());
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// simple case folding of code point (C and S mappings of CaseFolding.txt)
+
+constexpr uint_t code_point_fold(uint_t cp) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// case folded copy of string in any encoding
+
+template<typename chardst_t, typename type_t>
+auto case_fold(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// case insensitive equality of strings of any encodings, compares simple case folded code points
+
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int> = 0>
+bool equal_ignore_case(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept;
+template<typename lhs_t, typename rhs_t>
+auto equal_ignore_case(const lhs_t& lhs, const rhs_t& rhs) noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// encoding independent hash of case folded code points, equals to hash_code_points of folded string
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int> = 0>
+uint_t hash_ignore_case(it_t it, const it_t last) noexcept;
+template<typename type_t>
+auto hash_ignore_case(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline uint_t fold_next(it_t& it, const it_t last) noexcept
+{
+    // read and fold code point, code point truncated by the end of string is read as U+FFFD
+
+    const it_t next = code_point_next(it);
+
+    if (last - next < 0) {
+
+        it = last;
+        return 0xfffd;
+    }
+
+    const uint_t cp = code_point_fold(code_point_read(it));
+    it = next;
+
+    return cp;
+}
+
+
+
+#if defined(SUTF_SIMD_SSE2)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool load_ascii_block(const char_t* it, __m128i& bytes) noexcept
+{
+    // load 16 code units narrowed to bytes, returns false if any of them isn't ASCII
+
+    if constexpr (sizeof(char_t) == 1) {
+
+        bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        return _mm_movemask_epi8(bytes) == 0;
+
+    } else if constexpr (sizeof(char_t) == 2) {
+
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 8));
+        const __m128i high = _mm_and_si128(_mm_or_si128(lo, hi), _mm_set1_epi16(static_cast<short>(0xff80)));
+
+        bytes = _mm_packus_epi16(lo, hi);
+        return _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xffff;
+
+    } else {
+
+        __m128i units[4];
+        __m128i any = _mm_setzero_si128();
+
+        for (uint_t index = 0; index != 4; ++index) {
+
+            units[index] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + index * 4));
+            any = _mm_or_si128(any, units[index]);
+        }
+
+        const __m128i high = _mm_and_si128(any, _mm_set1_epi32(static_cast<int>(0xffffff80)));
+
+        bytes = _mm_packus_epi16(_mm_packs_epi32(units[0], units[1]), _mm_packs_epi32(units[2], units[3]));
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xffff;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline __m128i fold_ascii_block(__m128i bytes) noexcept
+{
+    // set bit 0x20 of upper case letters
+
+    const __m128i shifted = _mm_sub_epi8(bytes, _mm_set1_epi8('A'));
+    const __m128i upper = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(25)), shifted);
+
+    return _mm_or_si128(bytes, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif // SUTF_SIMD_SSE2
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool is_trailing_unit(uint_t unit) noexcept
+{
+    // UTF-8 continuation byte or UTF-16 low surrogate
+
+    if constexpr (sizeof(char_t) == 1)
+        return (unit & 0xc0) == 0x80;
+    else if constexpr (sizeof(char_t) == 2)
+        return (unit & 0xfc00) == 0xdc00;
+    else
+        return false;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itlhs_t, typename itrhs_t>
+inline bool equal_folded(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept
+{
+    using charlhs_t = typename std::iterator_traits<itlhs_t>::value_type;
+    using charrhs_t = typename std::iterator_traits<itrhs_t>::value_type;
+
+    if constexpr (std::is_pointer_v<itlhs_t> && std::is_pointer_v<itrhs_t>) {
+
+        while (true) {
+
+            // identical code units of the same encoding are skipped in bulk, the position is moved
+            // back to code point boundary, which is the same in both strings
+
+            if constexpr (sizeof(charlhs_t) == sizeof(charrhs_t)) {
+
+                const auto is_trailing = [&](uint_t index) {
+
+                    return (lhs + index != lhs_last && is_trailing_unit<charlhs_t>(static_cast<unit_t<charlhs_t>>(lhs[index]))) ||
+                        (rhs + index != rhs_last && is_trailing_unit<charrhs_t>(static_cast<unit_t<charrhs_t>>(rhs[index])));
+                };
+
+                uint_t index = unit_mismatch(reinterpret_cast<const unit_t<charlhs_t>*>(lhs), reinterpret_cast<const unit_t<charrhs_t>*>(rhs), std::min<uint_t>(lhs_last - lhs, rhs_last - rhs));
+
+                while (index != 0 && is_trailing(index))
+                    --index;
+
+                lhs += index;
+                rhs += index;
+            }
+
+#if defined(SUTF_SIMD_SSE2)
+            // ASCII blocks are compared after folding in registers
+
+            for (; lhs_last - lhs >= 16 && rhs_last - rhs >= 16; lhs += 16, rhs += 16) {
+
+                __m128i lhs_bytes;
+                __m128i rhs_bytes;
+
+                if (!load_ascii_block(lhs, lhs_bytes) || !load_ascii_block(rhs, rhs_bytes))
+                    break;
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(fold_ascii_block(lhs_bytes), fold_ascii_block(rhs_bytes))) != 0xffff)
+                    return false;
+            }
+#endif // SUTF_SIMD_SSE2
+
+            if (lhs == lhs_last || rhs == rhs_last)
+                break;
+
+            // code points near non-ASCII ones are folded by table
+
+            for (const itlhs_t stop = lhs + std::min<uint_t>(lhs_last - lhs, 16); lhs < stop && rhs != rhs_last;) {
+
+                if (fold_next(lhs, lhs_last) != fold_next(rhs, rhs_last))
+                    return false;
+            }
+        }
+
+    } else {
+
+        while (lhs != lhs_last && rhs != rhs_last) {
+
+            if (fold_next(lhs, lhs_last) != fold_next(rhs, rhs_last))
+                return false;
+        }
+    }
+
+    return lhs == lhs_last && rhs == rhs_last;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline uint_t hash_folded(it_t it, const it_t last) noexcept
+{
+    // hash UTF-8 representation of folded code points, as hash_code_points does
+
+    code_point_hasher hasher;
+
+    while (it != last) {
+
+#if defined(SUTF_SIMD_SSE2)
+        if constexpr (std::is_pointer_v<it_t>) {
+
+            __m128i bytes;
+
+            for (; last - it >= 16 && load_ascii_block(it, bytes); it += 16) {
+
+                alignas(16) std::uint64_t words[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(words), fold_ascii_block(bytes));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                words[0] = __builtin_bswap64(words[0]);
+                words[1] = __builtin_bswap64(words[1]);
+#endif
+
+                hasher.append(words[0], 8);
+                hasher.append(words[1], 8);
+            }
+
+            if (it == last)
+                break;
+        }
+#endif // SUTF_SIMD_SSE2
+
+        const it_t stop = it + std::min<uint_t>(last - it, 16);
+
+        while (last - it > 0 && (!std::is_pointer_v<it_t> || it < stop)) {
+
+            char buffer[4];
+            hasher.append_bytes(buffer, code_point_write(buffer, fold_next(it, last)) - buffer);
+        }
+    }
+
+    return hasher.finish();
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ignore_case_hash
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+inline auto ignore_case_hash::operator()(const type_t& str) const noexcept -> decltype(std::cbegin(str), uint_t())
+{
+    return hash_ignore_case(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ignore_case_equal_to
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename lhs_t, typename rhs_t>
+inline auto ignore_case_equal_to::operator()(const lhs_t& lhs, const rhs_t& rhs) const noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool())
+{
+    return equal_ignore_case(lhs, rhs);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr uint_t code_point_fold(uint_t cp) noexcept
+{
+    return cp < 0x110000 ? cp + impl::fold_delta[impl::fold_lookup(cp)] : cp;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto case_fold(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    auto [it, last] = impl::code_units_of(str);
+    std::basic_string<chardst_t> result;
+
+    result.reserve(last - it);
+
+    while (last - it > 0) {
+
+        chardst_t buffer[4];
+        result.append(buffer, code_point_write(buffer, impl::fold_next(it, last)) - buffer);
+    }
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int>>
+inline bool equal_ignore_case(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last) noexcept
+{
+    return impl::equal_folded(lhs, lhs_last, rhs, rhs_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename lhs_t, typename rhs_t>
+inline auto equal_ignore_case(const lhs_t& lhs, const rhs_t& rhs) noexcept -> decltype(std::cbegin(lhs), std::cbegin(rhs), bool())
+{
+    const auto [lhs_first, lhs_last] = impl::code_units_of(lhs);
+    const auto [rhs_first, rhs_last] = impl::code_units_of(rhs);
+
+    return impl::equal_folded(lhs_first, lhs_last, rhs_first, rhs_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
+inline uint_t hash_ignore_case(it_t it, const it_t last) noexcept
+{
+    return impl::hash_folded(it, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto hash_ignore_case(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t())
+{
+    const auto [first, last] = impl::code_units_of(str);
+
+    return impl::hash_folded(first, last);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_casefold.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,596 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_string.h"
+#include "utf_simd.h"
+
+#include <algorithm>
+#include <variant>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// compact_string
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// immutable code point string, stores every code point in 1, 2 or 4 bytes depending on
+// the largest code point of the string (Latin-1, UCS-2 or UTF-32 storage)
+
+class compact_string
+{
+public:
+    using value_type = char32_t;
+    using size_type = uint_t;
+    class const_iterator;
+
+    static constexpr uint_t npos = static_cast<uint_t>(-1);
+
+public:
+    compact_string() noexcept = default;
+    template<typename char_t>
+    explicit compact_string(const std::basic_string_view<char_t>& str);
+    template<typename char_t>
+    explicit compact_string(const std::basic_string<char_t>& str);
+    template<typename type_t, std::enable_if_t<is_native_string_v<type_t>, int> = 0>
+    explicit compact_string(const type_t& str);
+
+    uint_t size() const noexcept;
+    uint_t length() const noexcept;
+    bool empty() const noexcept;
+    uint_t width() const noexcept;
+    bool is_ascii() const noexcept;
+
+    char32_t operator[](uint_t pos) const noexcept;
+    char32_t at(uint_t pos) const;
+    compact_string substr(uint_t pos, uint_t count = npos) const;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    template<typename char_t>
+    std::basic_string<char_t> to_anystring() const;
+
+    friend bool operator==(const compact_string& lhs, const compact_string& rhs) noexcept;
+    friend bool operator!=(const compact_string& lhs, const compact_string& rhs) noexcept;
+    friend bool operator<(const compact_string& lhs, const compact_string& rhs) noexcept;
+
+private:
+    template<typename char_t>
+    void assign_code_units(const char_t* it, const char_t* last);
+    template<typename char_t>
+    void assign_code_points(const char_t* it, const char_t* last);
+    template<typename char_t>
+    void assign_unpacked(const char_t* it, const char_t* last, uint_t size, uint_t width, uint_t max);
+
+private:
+    std::variant<std::string, std::u16string, std::u32string> m_data;
+    bool m_ascii = true;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// compact_string::const_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class compact_string::const_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = char32_t;
+    using difference_type = int_t;
+    using pointer = void;
+    using reference = char32_t;
+
+public:
+    const_iterator() noexcept = default;
+
+    char32_t operator*() const noexcept { return (*m_str)[m_pos]; }
+    char32_t operator[](int_t offset) const noexcept { return (*m_str)[m_pos + offset]; }
+
+    const_iterator& operator++() noexcept { ++m_pos; return *this; }
+    const_iterator operator++(int) noexcept { const_iterator it = *this; ++m_pos; return it; }
+    const_iterator& operator--() noexcept { --m_pos; return *this; }
+    const_iterator operator--(int) noexcept { const_iterator it = *this; --m_pos; return it; }
+    const_iterator& operator+=(int_t offset) noexcept { m_pos += offset; return *this; }
+    const_iterator& operator-=(int_t offset) noexcept { m_pos -= offset; return *this; }
+
+    friend const_iterator operator+(const_iterator it, int_t offset) noexcept { return it += offset; }
+    friend const_iterator operator+(int_t offset, const_iterator it) noexcept { return it += offset; }
+    friend const_iterator operator-(const_iterator it, int_t offset) noexcept { return it -= offset; }
+    friend int_t operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos - rhs.m_pos; }
+
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos == rhs.m_pos; }
+    friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos != rhs.m_pos; }
+    friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos < rhs.m_pos; }
+    friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos > rhs.m_pos; }
+    friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos <= rhs.m_pos; }
+    friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.m_pos >= rhs.m_pos; }
+
+private:
+    friend class compact_string;
+    const_iterator(const compact_string* str, uint_t pos) noexcept
+        : m_str(str)
+        , m_pos(pos)
+    {
+    }
+
+private:
+    const compact_string* m_str = nullptr;
+    uint_t m_pos = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+string to_string(const compact_string& str);
+wstring to_wstring(const compact_string& str);
+u8string to_u8string(const compact_string& str);
+u16string to_u16string(const compact_string& str);
+u32string to_u32string(const compact_string& str);
+template<typename char_t>
+std::basic_string<char_t> to_anystring(const compact_string& str);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+template<typename char_t>
+inline uint_t compact_width(uint_t max) noexcept
+{
+    // largest code unit is mapped to the storage width of the largest code point
+
+    if constexpr (sizeof(char_t) == 1)
+        return max < 0xc4 ? 1 : max < 0xf0 ? 2 : 4;
+    else
+        return max < 0x100 ? 1 : max < 0x10000 ? 2 : 4;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline uint_t compact_encoded_size(const src_t* it, const src_t* last) noexcept
+{
+    // number of dst_t code units occupied by code points stored in fixed width units
+
+    if constexpr (sizeof(dst_t) == sizeof(char32_t)) {
+
+        return last - it;
+
+    } else if constexpr (sizeof(dst_t) == sizeof(char16_t) && sizeof(src_t) <= sizeof(char16_t)) {
+
+        return last - it;
+
+    } else {
+
+        uint_t size = 0;
+
+        while (it != last) {
+
+            const src_t* ascii = ascii_end(it, last);
+
+            size += ascii - it;
+            it = ascii;
+
+            for (; it != last && static_cast<unit_t<src_t>>(*it) >= 0x80; ++it)
+                size += code_unit_count<dst_t>(static_cast<unit_t<src_t>>(*it));
+        }
+
+        return size;
+    }
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// compact_string
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline compact_string::compact_string(const std::basic_string_view<char_t>& str)
+{
+    assign_code_units(str.data(), str.data() + str.size());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline compact_string::compact_string(const std::basic_string<char_t>& str)
+{
+    assign_code_units(str.data(), str.data() + str.size());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_native_string_v<type_t>, int>>
+inline compact_string::compact_string(const type_t& str)
+{
+    if constexpr (is_char_array_v<type_t>) {
+        assign_code_units(std::data(str), std::data(str) + std::size(str) - 1);
+    } else {
+        const std::basic_string_view view(str);
+        assign_code_units(view.data(), view.data() + view.size());
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t compact_string::size() const noexcept
+{
+    return std::visit([](const auto& data) { return static_cast<uint_t>(data.size()); }, m_data);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t compact_string::length() const noexcept
+{
+    return size();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool compact_string::empty() const noexcept
+{
+    return size() == 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t compact_string::width() const noexcept
+{
+    return uint_t(1) << m_data.index();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool compact_string::is_ascii() const noexcept
+{
+    return m_ascii;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline char32_t compact_string::operator[](uint_t pos) const noexcept
+{
+    assert(pos < size());
+
+    switch (m_data.index()) {
+    case 0: return static_cast<unsigned char>((*std::get_if<0>(&m_data))[pos]);
+    case 1: return (*std::get_if<1>(&m_data))[pos];
+    default: return (*std::get_if<2>(&m_data))[pos];
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline char32_t compact_string::at(uint_t pos) const
+{
+    if (pos >= size())
+        throw std::out_of_range("Code point position is out of compact string range.");
+
+    return (*this)[pos];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline compact_string compact_string::substr(uint_t pos, uint_t count) const
+{
+    if (pos > size())
+        throw std::out_of_range("Code point position is out of compact string range.");
+
+    count = std::min(count, size() - pos);
+
+    compact_string out;
+    std::visit([&](const auto& data) { out.assign_code_points(data.data() + pos, data.data() + pos + count); }, m_data);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline compact_string::const_iterator compact_string::begin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline compact_string::const_iterator compact_string::end() const noexcept
+{
+    return const_iterator(this, size());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline compact_string::const_iterator compact_string::cbegin() const noexcept
+{
+    return begin();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline compact_string::const_iterator compact_string::cend() const noexcept
+{
+    return end();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline std::basic_string<char_t> compact_string::to_anystring() const
+{
+    return std::visit([&](const auto& data) {
+        using unit_t = typename std::decay_t<decltype(data)>::value_type;
+
+        const unit_t* it = data.data();
+        const unit_t* last = it + data.size();
+
+        std::basic_string<char_t> out;
+
+        if (m_ascii || sizeof(char_t) == sizeof(char32_t) || (sizeof(char_t) == sizeof(char16_t) && sizeof(unit_t) <= sizeof(char16_t))) {
+
+            // every code point occupies exactly one destination code unit
+
+            out.resize(data.size());
+            impl::copy_units(it, last, out.data());
+
+        } else {
+
+            out.resize(impl::compact_encoded_size<char_t>(it, last));
+            impl::pack_code_points(it, last, out.data());
+        }
+
+        return out;
+    },
+        m_data);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool operator==(const compact_string& lhs, const compact_string& rhs) noexcept
+{
+    // storage width is always minimal, so equal strings have equal storage
+
+    return lhs.m_data == rhs.m_data;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool operator!=(const compact_string& lhs, const compact_string& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool operator<(const compact_string& lhs, const compact_string& rhs) noexcept
+{
+    if (lhs.m_data.index() == rhs.m_data.index())
+        return lhs.m_data < rhs.m_data;
+
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void compact_string::assign_code_units(const char_t* it, const char_t* last)
+{
+    if constexpr (sizeof(char_t) == sizeof(char32_t)) {
+
+        assign_code_points(it, last);
+
+    } else {
+
+        const uint_t max = impl::unit_max(it, last);
+
+        if (max < 0x80) {
+
+            assign_unpacked(it, last, last - it, 1, max);
+
+        } else if constexpr (sizeof(char_t) == sizeof(char16_t)) {
+
+            // lone surrogates decode to UCS-2 code points, so the width is checked after decoding
+
+            if (impl::surrogate_find(it, last) == last) {
+
+                assign_unpacked(it, last, last - it, impl::compact_width<char_t>(max), max);
+
+            } else {
+
+                assign_unpacked(it, last, code_point_count(it, last), 4, max);
+
+                if (const std::u32string& data = std::get<2>(m_data); impl::unit_max(data.data(), data.data() + data.size()) < 0x10000)
+                    assign_code_points(data.data(), data.data() + data.size());
+            }
+
+        } else {
+
+            assign_unpacked(it, last, code_point_count(it, last), impl::compact_width<char_t>(max), max);
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void compact_string::assign_code_points(const char_t* it, const char_t* last)
+{
+    const uint_t max = impl::unit_max(it, last);
+
+    m_ascii = max < 0x80;
+
+    switch (impl::compact_width<char32_t>(max)) {
+    case 1: {
+        std::string data(last - it, '\0');
+        impl::copy_units(it, last, data.data());
+        m_data = std::move(data);
+        break;
+    }
+    case 2: {
+        std::u16string data(last - it, u'\0');
+        impl::copy_units(it, last, data.data());
+        m_data = std::move(data);
+        break;
+    }
+    default: {
+        std::u32string data(last - it, U'\0');
+        impl::copy_units(it, last, data.data());
+        m_data = std::move(data);
+        break;
+    }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void compact_string::assign_unpacked(const char_t* it, const char_t* last, uint_t size, uint_t width, uint_t max)
+{
+    // the maximum code unit is below 0x80 only for ASCII strings in any encoding
+
+    m_ascii = max < 0x80;
+
+    switch (width) {
+    case 1: {
+        std::string data(size, '\0');
+        impl::unpack_code_points(it, last, data.data());
+        m_data = std::move(data);
+        break;
+    }
+    case 2: {
+        std::u16string data(size, u'\0');
+        impl::unpack_code_points(it, last, data.data());
+        m_data = std::move(data);
+        break;
+    }
+    default: {
+        std::u32string data(size, U'\0');
+        impl::unpack_code_points(it, last, data.data());
+        m_data = std::move(data);
+        break;
+    }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline string to_string(const compact_string& str)
+{
+    return str.to_anystring<char>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline wstring to_wstring(const compact_string& str)
+{
+    return str.to_anystring<wchar_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline u8string to_u8string(const compact_string& str)
+{
+    return str.to_anystring<char8s_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline u16string to_u16string(const compact_string& str)
+{
+    return str.to_anystring<char16_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline u32string to_u32string(const compact_string& str)
+{
+    return str.to_anystring<char32_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline std::basic_string<char_t> to_anystring(const compact_string& str)
+{
+    return str.to_anystring<char_t>();
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_compact_string.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
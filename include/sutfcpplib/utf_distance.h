@@ -0,0 +1,473 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_scratch.h"
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Levenshtein distance between strings of any encodings in code points, the distance over
+// max_distance stops the computation early and max_distance + 1 is returned, the shorter string
+// up to 64 code points is handled without allocation, longer ones use thread local scratch buffer
+
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int> = 0>
+uint_t edit_distance(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last, uint_t max_distance = npos);
+template<typename lhs_t, typename rhs_t>
+auto edit_distance(const lhs_t& lhs, const rhs_t& rhs, uint_t max_distance = npos) -> decltype(std::cbegin(lhs), std::cbegin(rhs), uint_t());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// positions of up to 64 code points of the pattern for every code point, ASCII ones are indexed
+// directly, the other ones are in open addressing hash table which is never more than half full,
+// touched entries are remembered, so that the table is reset without clearing all of it, the
+// table is left uninitialized by default construction and must be cleared before use
+
+struct distance_pattern
+{
+    static constexpr uint_t slots = 128;
+    static constexpr std::uint32_t empty = 0xffffffff;
+
+    std::uint64_t ascii[128];
+    std::uint32_t keys[slots];
+    std::uint64_t masks[slots];
+    std::uint8_t touched[64];
+    uint_t touched_count;
+
+    static distance_pattern make() noexcept
+    {
+        distance_pattern pattern;
+        pattern.clear();
+
+        return pattern;
+    }
+
+    void clear() noexcept
+    {
+        std::fill(std::begin(ascii), std::end(ascii), 0);
+        std::fill(std::begin(keys), std::end(keys), empty);
+        touched_count = 0;
+    }
+
+    void reset() noexcept
+    {
+        // ASCII code points and hash table slots with high bit set
+
+        for (uint_t index = 0; index != touched_count; ++index) {
+
+            if (touched[index] < 0x80)
+                ascii[touched[index]] = 0;
+            else
+                keys[touched[index] & 0x7f] = empty;
+        }
+
+        touched_count = 0;
+    }
+
+    static uint_t slot_of(uint_t cp) noexcept
+    {
+        return (static_cast<std::uint32_t>(cp * 0x9e3779b1) >> 25) & (slots - 1);
+    }
+
+    void add(uint_t cp, std::uint64_t bit) noexcept
+    {
+        if (cp < 0x80) {
+
+            if (ascii[cp] == 0)
+                touched[touched_count++] = static_cast<std::uint8_t>(cp);
+
+            ascii[cp] |= bit;
+            return;
+        }
+
+        uint_t slot = slot_of(cp);
+
+        while (keys[slot] != empty && keys[slot] != cp)
+            slot = (slot + 1) & (slots - 1);
+
+        if (keys[slot] == empty) {
+
+            keys[slot] = static_cast<std::uint32_t>(cp);
+            masks[slot] = 0;
+            touched[touched_count++] = static_cast<std::uint8_t>(slot | 0x80);
+        }
+
+        masks[slot] |= bit;
+    }
+
+    std::uint64_t get(uint_t cp) const noexcept
+    {
+        if (cp < 0x80)
+            return ascii[cp];
+
+        for (uint_t slot = slot_of(cp);; slot = (slot + 1) & (slots - 1)) {
+
+            if (keys[slot] == cp)
+                return masks[slot];
+
+            if (keys[slot] == empty)
+                return 0;
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// 64 rows of the pattern with vertical deltas of the last column, set bits of positive and
+// negative masks are +1 and -1 deltas
+
+struct distance_block
+{
+    distance_pattern pattern;
+    std::uint64_t positive;
+    std::uint64_t negative;
+};
+
+// blocks of patterns up to the scratch capacity in bytes are kept by the thread for the next
+// calls, the larger ones are released on return
+
+constexpr uint_t max_retained_blocks = std::max<uint_t>(SUTF_SCRATCH_CAPACITY * sizeof(char32_t) / sizeof(distance_block), 1);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline uint_t distance_read(it_t& it, const it_t last) noexcept
+{
+    // truncated code point at the end is read as replacement character
+
+    const uint_t unit = static_cast<std::make_unsigned_t<typename std::iterator_traits<it_t>::value_type>>(*it);
+
+    if (unit < 0x80) {
+
+        ++it;
+        return unit;
+    }
+
+    const it_t next = code_point_next(it);
+
+    if (last - next < 0) {
+
+        it = last;
+        return 0xfffd;
+    }
+
+    const uint_t cp = code_point_read(it);
+    it = next;
+
+    return cp;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline uint_t distance_length(it_t it, const it_t last) noexcept
+{
+    // contiguous strings are measured by SIMD, the length is exact for valid strings and is used
+    // only to choose the pattern and to stop early
+
+    if constexpr (std::is_pointer_v<it_t>) {
+
+        return (last - it) - continuation_count(it, last);
+
+    } else {
+
+        uint_t count = 0;
+
+        for (; it != last; ++count)
+            distance_read(it, last);
+
+        return count;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline it_t distance_fill(distance_pattern& pattern, it_t it, const it_t last, uint_t& count) noexcept
+{
+    // positions of the next 64 code points
+
+    count = 0;
+
+    for (std::uint64_t bit = 1; bit != 0 && it != last; bit <<= 1, ++count)
+        pattern.add(distance_read(it, last), bit);
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool distance_exceeded(uint_t score, uint_t& text_size, uint_t max_distance) noexcept
+{
+    // the remaining code points of the text can decrease the score by one at most
+
+    text_size -= text_size != 0;
+
+    return score > text_size && score - text_size > max_distance;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename ittext_t>
+inline uint_t myers_distance(const distance_pattern& masks, uint_t pattern_size, ittext_t text, const ittext_t text_last, uint_t text_size, uint_t max_distance) noexcept
+{
+    // Myers bit-parallel algorithm, the score is the distance between the pattern and the text
+    // prefix
+
+    const std::uint64_t last_row = std::uint64_t(1) << (pattern_size - 1);
+    std::uint64_t positive = ~std::uint64_t(0);
+    std::uint64_t negative = 0;
+    uint_t score = pattern_size;
+
+    while (text != text_last) {
+
+        const std::uint64_t equal = masks.get(distance_read(text, text_last));
+        const std::uint64_t diagonal = (((equal & positive) + positive) ^ positive) | equal | negative;
+        std::uint64_t horizontal_positive = negative | ~(diagonal | positive);
+        std::uint64_t horizontal_negative = positive & diagonal;
+
+        score += (horizontal_positive & last_row) != 0;
+        score -= (horizontal_negative & last_row) != 0;
+
+        if (distance_exceeded(score, text_size, max_distance))
+            return max_distance + 1;
+
+        horizontal_positive = (horizontal_positive << 1) | 1;
+        horizontal_negative <<= 1;
+        positive = horizontal_negative | ~(diagonal | horizontal_positive);
+        negative = horizontal_positive & diagonal;
+    }
+
+    return score;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline distance_block* distance_reserve(std::unique_ptr<distance_block[]>& owned, uint_t count)
+{
+    // blocks are allocated without initialization, every used block is cleared by the caller
+
+    thread_local scratch_buffer<distance_block> retained;
+
+    if (count > max_retained_blocks) {
+
+        owned.reset(new distance_block[count]);
+        return owned.get();
+    }
+
+    if (count > retained.capacity) {
+
+        const uint_t capacity = std::max<uint_t>(count, std::min<uint_t>(retained.capacity * 2, max_retained_blocks));
+
+        retained.data.reset();
+        retained.data.reset(new distance_block[capacity]);
+        retained.capacity = capacity;
+    }
+
+    return retained.data.get();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itpattern_t, typename ittext_t>
+inline uint_t blocked_distance(itpattern_t pattern, const itpattern_t pattern_last, uint_t pattern_size, ittext_t text, const ittext_t text_last, uint_t text_size, uint_t max_distance)
+{
+    // Myers algorithm with blocks of 64 rows, every block passes horizontal delta of its last row
+    // to the next block, the first row grows by one for every code point, invalid pattern may have
+    // more code points than estimated, then the number of its units limits the number of blocks
+
+    uint_t block_count = (pattern_size + 63) / 64;
+    std::unique_ptr<distance_block[]> owned;
+    distance_block* blocks;
+    uint_t last_size = 0;
+
+    while (true) {
+
+        blocks = distance_reserve(owned, block_count);
+
+        itpattern_t it = pattern;
+        uint_t index = 0;
+
+        pattern_size = 0;
+
+        for (; index != block_count && it != pattern_last; ++index) {
+
+            blocks[index].pattern.clear();
+            it = distance_fill(blocks[index].pattern, it, pattern_last, last_size);
+            pattern_size += last_size;
+            blocks[index].positive = ~std::uint64_t(0);
+            blocks[index].negative = 0;
+        }
+
+        if (it == pattern_last) {
+
+            block_count = index;
+            break;
+        }
+
+        block_count = (pattern_last - pattern + 63) / 64;
+    }
+
+    const std::uint64_t last_row = std::uint64_t(1) << (last_size - 1);
+    uint_t score = pattern_size;
+
+    while (text != text_last) {
+
+        const uint_t cp = distance_read(text, text_last);
+        int_t carry = 1;
+
+        for (uint_t index = 0; index != block_count; ++index) {
+
+            distance_block& block = blocks[index];
+            const std::uint64_t row = index + 1 != block_count ? std::uint64_t(1) << 63 : last_row;
+
+            std::uint64_t equal = block.pattern.get(cp);
+            const std::uint64_t vertical = equal | block.negative;
+
+            if (carry < 0)
+                equal |= 1;
+
+            const std::uint64_t diagonal = (((equal & block.positive) + block.positive) ^ block.positive) | equal;
+            std::uint64_t horizontal_positive = block.negative | ~(diagonal | block.positive);
+            std::uint64_t horizontal_negative = block.positive & diagonal;
+            const int_t carry_in = carry;
+
+            carry = (horizontal_positive & row) != 0 ? 1 : (horizontal_negative & row) != 0 ? -1 : 0;
+
+            horizontal_positive = (horizontal_positive << 1) | (carry_in > 0);
+            horizontal_negative = (horizontal_negative << 1) | (carry_in < 0);
+            block.positive = horizontal_negative | ~(vertical | horizontal_positive);
+            block.negative = horizontal_positive & vertical;
+        }
+
+        score += carry;
+
+        if (distance_exceeded(score, text_size, max_distance))
+            return max_distance + 1;
+    }
+
+    return score;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename itlhs_t, typename itrhs_t>
+inline uint_t edit_distance_units(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last, uint_t max_distance)
+{
+    // the shorter string is the pattern, so that the number of blocks is minimal, the distance is
+    // at least the difference of lengths
+
+    const uint_t lhs_size = distance_length(lhs, lhs_last);
+    const uint_t rhs_size = distance_length(rhs, rhs_last);
+
+    if (std::max(lhs_size, rhs_size) - std::min(lhs_size, rhs_size) > max_distance)
+        return max_distance + 1;
+
+    if (lhs_size > rhs_size)
+        return edit_distance_units(rhs, rhs_last, lhs, lhs_last, max_distance);
+
+    if (lhs == lhs_last)
+        return rhs_size;
+
+    if (lhs_size <= 64) {
+
+        // the pattern table is thread local and is reset after use, so that short patterns
+        // don't allocate or clear the whole table, invalid strings may turn out to be longer
+
+        thread_local distance_pattern masks = distance_pattern::make();
+        uint_t pattern_size;
+
+        if (distance_fill(masks, lhs, lhs_last, pattern_size) == lhs_last) {
+
+            const uint_t result = myers_distance(masks, pattern_size, rhs, rhs_last, rhs_size, max_distance);
+            masks.reset();
+
+            return result;
+        }
+
+        masks.reset();
+    }
+
+    return blocked_distance(lhs, lhs_last, lhs_size, rhs, rhs_last, rhs_size, max_distance);
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename itlhs_t, typename itrhs_t, std::enable_if_t<is_any_const_iterator_v<itlhs_t> && is_any_const_iterator_v<itrhs_t>, int>>
+inline uint_t edit_distance(itlhs_t lhs, const itlhs_t lhs_last, itrhs_t rhs, const itrhs_t rhs_last, uint_t max_distance)
+{
+    return impl::edit_distance_units(lhs, lhs_last, rhs, rhs_last, max_distance);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename lhs_t, typename rhs_t>
+inline auto edit_distance(const lhs_t& lhs, const rhs_t& rhs, uint_t max_distance) -> decltype(std::cbegin(lhs), std::cbegin(rhs), uint_t())
+{
+    const auto [lhs_first, lhs_last] = impl::code_units_of(lhs);
+    const auto [rhs_first, rhs_last] = impl::code_units_of(rhs);
+
+    return impl::edit_distance_units(lhs_first, lhs_last, rhs_first, rhs_last, max_distance);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_distance.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1782 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_string.h"
+#include "utf_simd.h"
+
+#include <algorithm>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// latin1_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// iterator over Latin-1 (ISO-8859-1) bytes, every byte is read as UTF-32 code unit, so that
+// low level routines accept Latin-1 buffers as UTF-32 ones
+
+class latin1_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = char32_t;
+    using difference_type = int_t;
+    using pointer = void;
+    using reference = char32_t;
+
+public:
+    constexpr latin1_iterator() noexcept = default;
+    constexpr explicit latin1_iterator(const char* it) noexcept
+        : m_it(it)
+    {
+    }
+
+    constexpr const char* base() const noexcept { return m_it; }
+
+    constexpr char32_t operator*() const noexcept { return static_cast<unsigned char>(*m_it); }
+    constexpr char32_t operator[](int_t offset) const noexcept { return static_cast<unsigned char>(m_it[offset]); }
+
+    constexpr latin1_iterator& operator++() noexcept { ++m_it; return *this; }
+    constexpr latin1_iterator operator++(int) noexcept { latin1_iterator it = *this; ++m_it; return it; }
+    constexpr latin1_iterator& operator--() noexcept { --m_it; return *this; }
+    constexpr latin1_iterator operator--(int) noexcept { latin1_iterator it = *this; --m_it; return it; }
+    constexpr latin1_iterator& operator+=(int_t offset) noexcept { m_it += offset; return *this; }
+    constexpr latin1_iterator& operator-=(int_t offset) noexcept { m_it -= offset; return *this; }
+
+    friend constexpr latin1_iterator operator+(latin1_iterator it, int_t offset) noexcept { return it += offset; }
+    friend constexpr latin1_iterator operator+(int_t offset, latin1_iterator it) noexcept { return it += offset; }
+    friend constexpr latin1_iterator operator-(latin1_iterator it, int_t offset) noexcept { return it -= offset; }
+    friend constexpr int_t operator-(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it - rhs.m_it; }
+
+    friend constexpr bool operator==(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it == rhs.m_it; }
+    friend constexpr bool operator!=(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it != rhs.m_it; }
+    friend constexpr bool operator<(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it < rhs.m_it; }
+    friend constexpr bool operator>(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it > rhs.m_it; }
+    friend constexpr bool operator<=(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it <= rhs.m_it; }
+    friend constexpr bool operator>=(const latin1_iterator& lhs, const latin1_iterator& rhs) noexcept { return lhs.m_it >= rhs.m_it; }
+
+private:
+    const char* m_it = nullptr;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// latin1_view
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// marks byte buffer as Latin-1 encoded string for high level convertors
+
+class latin1_view
+{
+public:
+    using value_type = char32_t;
+    using const_iterator = latin1_iterator;
+
+public:
+    constexpr latin1_view() noexcept = default;
+    constexpr explicit latin1_view(const string_view& str) noexcept
+        : m_str(str)
+    {
+    }
+
+    constexpr const char* data() const noexcept { return m_str.data(); }
+    constexpr uint_t size() const noexcept { return m_str.size(); }
+    constexpr bool empty() const noexcept { return m_str.empty(); }
+    constexpr string_view bytes() const noexcept { return m_str; }
+
+    constexpr const_iterator begin() const noexcept { return const_iterator(m_str.data()); }
+    constexpr const_iterator end() const noexcept { return const_iterator(m_str.data() + m_str.size()); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+private:
+    string_view m_str;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// byte_order
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class byte_order {
+    little,
+    big,
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    native = little
+#else
+    native = big
+#endif
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// endian_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// iterator over UTF-16 or UTF-32 code units stored as bytes in the specified byte order
+
+template<typename char_t, byte_order order>
+class endian_iterator
+{
+    static_assert(std::is_same_v<char_t, char16_t> || std::is_same_v<char_t, char32_t>);
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = char_t;
+    using difference_type = int_t;
+    using pointer = void;
+    using reference = char_t;
+
+public:
+    constexpr endian_iterator() noexcept = default;
+    constexpr explicit endian_iterator(const char* it) noexcept
+        : m_it(it)
+    {
+    }
+
+    constexpr const char* base() const noexcept { return m_it; }
+
+    constexpr char_t operator*() const noexcept { return read(m_it); }
+    constexpr char_t operator[](int_t offset) const noexcept { return read(m_it + offset * sizeof(char_t)); }
+
+    constexpr endian_iterator& operator++() noexcept { m_it += sizeof(char_t); return *this; }
+    constexpr endian_iterator operator++(int) noexcept { endian_iterator it = *this; m_it += sizeof(char_t); return it; }
+    constexpr endian_iterator& operator--() noexcept { m_it -= sizeof(char_t); return *this; }
+    constexpr endian_iterator operator--(int) noexcept { endian_iterator it = *this; m_it -= sizeof(char_t); return it; }
+    constexpr endian_iterator& operator+=(int_t offset) noexcept { m_it += offset * static_cast<int_t>(sizeof(char_t)); return *this; }
+    constexpr endian_iterator& operator-=(int_t offset) noexcept { m_it -= offset * static_cast<int_t>(sizeof(char_t)); return *this; }
+
+    friend constexpr endian_iterator operator+(endian_iterator it, int_t offset) noexcept { return it += offset; }
+    friend constexpr endian_iterator operator+(int_t offset, endian_iterator it) noexcept { return it += offset; }
+    friend constexpr endian_iterator operator-(endian_iterator it, int_t offset) noexcept { return it -= offset; }
+    friend constexpr int_t operator-(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return (lhs.m_it - rhs.m_it) / static_cast<int_t>(sizeof(char_t)); }
+
+    friend constexpr bool operator==(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return lhs.m_it == rhs.m_it; }
+    friend constexpr bool operator!=(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return lhs.m_it != rhs.m_it; }
+    friend constexpr bool operator<(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return lhs.m_it < rhs.m_it; }
+    friend constexpr bool operator>(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return lhs.m_it > rhs.m_it; }
+    friend constexpr bool operator<=(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return lhs.m_it <= rhs.m_it; }
+    friend constexpr bool operator>=(const endian_iterator& lhs, const endian_iterator& rhs) noexcept { return lhs.m_it >= rhs.m_it; }
+
+private:
+    static constexpr char_t read(const char* it) noexcept
+    {
+        std::uint32_t unit = 0;
+
+        for (uint_t index = 0; index != sizeof(char_t); ++index) {
+
+            const std::uint32_t byte = static_cast<unsigned char>(it[index]);
+            unit |= order == byte_order::big ? byte << ((sizeof(char_t) - 1 - index) * 8) : byte << (index * 8);
+        }
+
+        return static_cast<char_t>(unit);
+    }
+
+private:
+    const char* m_it = nullptr;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// endian_view
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// marks byte buffer as UTF-16 or UTF-32 string in the specified byte order for high level
+// convertors, an incomplete trailing code unit is ignored
+
+template<typename char_t, byte_order order>
+class endian_view
+{
+public:
+    using value_type = char_t;
+    using const_iterator = endian_iterator<char_t, order>;
+
+public:
+    constexpr endian_view() noexcept = default;
+    constexpr explicit endian_view(const string_view& bytes) noexcept
+        : m_bytes(bytes.substr(0, bytes.size() - bytes.size() % sizeof(char_t)))
+    {
+    }
+
+    constexpr const char* data() const noexcept { return m_bytes.data(); }
+    constexpr uint_t size() const noexcept { return m_bytes.size() / sizeof(char_t); }
+    constexpr bool empty() const noexcept { return m_bytes.empty(); }
+    constexpr string_view bytes() const noexcept { return m_bytes; }
+
+    constexpr const_iterator begin() const noexcept { return const_iterator(m_bytes.data()); }
+    constexpr const_iterator end() const noexcept { return const_iterator(m_bytes.data() + m_bytes.size()); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+private:
+    string_view m_bytes;
+};
+
+using utf16le_view = endian_view<char16_t, byte_order::little>;
+using utf16be_view = endian_view<char16_t, byte_order::big>;
+using utf32le_view = endian_view<char32_t, byte_order::little>;
+using utf32be_view = endian_view<char32_t, byte_order::big>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// encoding
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class encoding {
+    unknown,
+    latin1,
+    utf8,
+    utf16le,
+    utf16be,
+    utf32le,
+    utf32be
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// detection
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// result of encoding detection, confidence is in range [0, 1], bom_size is the number of bytes
+// occupied by byte order mark to skip before conversion
+
+struct detection
+{
+    encoding type = encoding::unknown;
+    uint_t bom_size = 0;
+    float confidence = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Latin-1 source convertors
+
+string to_string(const latin1_view& str);
+wstring to_wstring(const latin1_view& str);
+u8string to_u8string(const latin1_view& str);
+u16string to_u16string(const latin1_view& str);
+u32string to_u32string(const latin1_view& str);
+template<typename chardst_t>
+std::basic_string<chardst_t> to_anystring(const latin1_view& str);
+template<typename type_t>
+auto convert(const latin1_view& src, type_t& dst) -> decltype(std::begin(dst), std::end(dst), uint_t());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Latin-1 destination convertors, code points out of Latin-1 range either throw std::range_error
+// or are replaced by the specified character
+
+string to_latin1(const string_view& str);
+string to_latin1(const wstring_view& str);
+string to_latin1(const u8string_view& str);
+string to_latin1(const u16string_view& str);
+string to_latin1(const u32string_view& str);
+template<typename type_t, std::enable_if_t<is_native_string_v<type_t>, int> = 0>
+string to_latin1(const type_t& str);
+template<typename char_t>
+string to_latin1(const std::basic_string_view<char_t>& str);
+
+string to_latin1(const string_view& str, char replacement);
+string to_latin1(const wstring_view& str, char replacement);
+string to_latin1(const u8string_view& str, char replacement);
+string to_latin1(const u16string_view& str, char replacement);
+string to_latin1(const u32string_view& str, char replacement);
+template<typename type_t, std::enable_if_t<is_native_string_v<type_t>, int> = 0>
+string to_latin1(const type_t& str, char replacement);
+template<typename char_t>
+string to_latin1(const std::basic_string_view<char_t>& str, char replacement);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// byte ordered UTF-16/UTF-32 source convertors
+
+template<typename char_t, byte_order order>
+string to_string(const endian_view<char_t, order>& str);
+template<typename char_t, byte_order order>
+wstring to_wstring(const endian_view<char_t, order>& str);
+template<typename char_t, byte_order order>
+u8string to_u8string(const endian_view<char_t, order>& str);
+template<typename char_t, byte_order order>
+u16string to_u16string(const endian_view<char_t, order>& str);
+template<typename char_t, byte_order order>
+u32string to_u32string(const endian_view<char_t, order>& str);
+template<typename chardst_t, typename char_t, byte_order order>
+std::basic_string<chardst_t> to_anystring(const endian_view<char_t, order>& str);
+template<typename char_t, byte_order order, typename type_t>
+auto convert(const endian_view<char_t, order>& src, type_t& dst) -> decltype(std::begin(dst), std::end(dst), uint_t());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// byte ordered UTF-16/UTF-32 destination convertors, return strings of bytes
+
+template<typename type_t>
+string to_utf16le(const type_t& str);
+template<typename type_t>
+string to_utf16be(const type_t& str);
+template<typename type_t>
+string to_utf32le(const type_t& str);
+template<typename type_t>
+string to_utf32be(const type_t& str);
+template<typename char_t, byte_order order, typename type_t>
+string to_endian(const type_t& str);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// encoding detection, only the first max_size bytes after byte order mark are examined
+
+detection detect_encoding(const string_view& bytes, uint_t max_size = 4096) noexcept;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+template<typename type_t, typename = void>
+constexpr bool is_contiguous_v = false;
+template<typename type_t>
+constexpr bool is_contiguous_v<type_t, std::void_t<decltype(std::data(std::declval<type_t&>()))>> = true;
+
+#if defined(SUTF_SIMD_SSSE3)
+struct latin1_shuffle_table
+{
+    alignas(16) std::uint8_t data[256][16];
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr latin1_shuffle_table make_latin1_shuffle_table() noexcept
+{
+    // byte pairs of 16-bit lanes are compacted, lanes of ASCII characters keep only the low byte
+
+    latin1_shuffle_table table = {};
+
+    for (uint_t mask = 0; mask != 256; ++mask) {
+
+        uint_t size = 0;
+
+        for (uint_t lane = 0; lane != 8; ++lane) {
+
+            table.data[mask][size++] = static_cast<std::uint8_t>(lane * 2);
+
+            if (mask & (uint_t(1) << lane))
+                table.data[mask][size++] = static_cast<std::uint8_t>(lane * 2 + 1);
+        }
+
+        while (size != 16)
+            table.data[mask][size++] = 0x80;
+    }
+
+    return table;
+}
+
+
+
+inline constexpr latin1_shuffle_table latin1_shuffle = make_latin1_shuffle_table();
+#endif // SUTF_SIMD_SSSE3
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t>
+inline dst_t* latin1_to_utf8(const char* it, const char* last, dst_t* dst) noexcept
+{
+    static_assert(sizeof(dst_t) == 1);
+
+#if defined(SUTF_SIMD_SSE2)
+    while (last - it >= 16) {
+
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const std::uint32_t mask = _mm_movemask_epi8(bytes);
+
+        if (mask == 0) {
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+            it += 16;
+            dst += 16;
+            continue;
+        }
+
+#if defined(SUTF_SIMD_SSSE3)
+        // expand low 8 bytes to 16-bit lanes holding either ASCII byte or two byte sequence,
+        // the store may overrun by 8 bytes at most, which are covered by the rest of input
+
+        const __m128i lanes = _mm_unpacklo_epi8(bytes, _mm_setzero_si128());
+        const __m128i lead = _mm_or_si128(_mm_srli_epi16(lanes, 6), _mm_set1_epi16(0xc0));
+        const __m128i trail = _mm_slli_epi16(_mm_or_si128(_mm_and_si128(lanes, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80)), 8);
+        const __m128i ascii = _mm_cmpgt_epi16(_mm_set1_epi16(0x80), lanes);
+        const __m128i pairs = _mm_or_si128(_mm_and_si128(ascii, lanes), _mm_andnot_si128(ascii, _mm_or_si128(lead, trail)));
+        const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(latin1_shuffle.data[mask & 0xff]));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(pairs, shuffle));
+        it += 8;
+        dst += 8 + bit_count(mask & 0xff);
+#else
+        for (const char* block = it + 16; it != block; ++it)
+            dst = code_point_write(dst, static_cast<unsigned char>(*it));
+#endif // SUTF_SIMD_SSSE3
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it)
+        dst = code_point_write(dst, static_cast<unsigned char>(*it));
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t>
+inline dst_t* latin1_to_any(const char* it, const char* last, dst_t* dst) noexcept
+{
+    if constexpr (sizeof(dst_t) == 1)
+        return latin1_to_utf8(it, last, dst);
+    else
+        return widen(it, last, dst);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t latin1_size(const latin1_view& str) noexcept
+{
+    if constexpr (sizeof(char_t) == 1)
+        return str.size() + non_ascii_count(str.data(), str.data() + str.size());
+    else
+        return str.size();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline char* any_to_latin1(const char_t* it, const char_t* last, char* dst, const char* replacement) noexcept
+{
+    // bulk copy runs of units which are Latin-1 code points, decode the rest one by one,
+    // returns nullptr if code point doesn't fit and there is no replacement
+
+    while (it != last) {
+
+        const char_t* run;
+
+        if constexpr (sizeof(char_t) == 1)
+            run = ascii_end(it, last);
+        else
+            run = unit_bound_end<8>(it, last);
+
+        dst = copy_units(it, run, dst);
+        it = run;
+
+        if (it == last)
+            break;
+
+        const uint_t cp = code_point_read(it);
+        it = code_point_next(it);
+
+        if (cp < 0x100)
+            *dst++ = static_cast<char>(cp);
+        else if (replacement)
+            *dst++ = *replacement;
+        else
+            return nullptr;
+    }
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline string to_latin1(const std::basic_string_view<char_t>& str, const char* replacement)
+{
+    const char_t* it = str.data();
+    const char_t* last = it + str.size();
+
+    string out;
+    out.resize(sizeof(char_t) == sizeof(char32_t) ? str.size() : code_point_count(it, last));
+
+    if (!any_to_latin1(it, last, out.data(), replacement))
+        throw std::range_error("Code point can't be represented in Latin-1 encoding.");
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto view_of(const type_t& str) noexcept
+{
+    if constexpr (is_char_array_v<type_t>)
+        return std::basic_string_view(str, std::size(str) - 1);
+    else if constexpr (is_native_string_v<type_t>)
+        return std::basic_string_view(str);
+    else
+        return std::basic_string_view<typename type_t::value_type>(std::data(str), std::size(str));
+}
+
+
+
+#if defined(SUTF_SIMD_SSE2)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<uint_t size, byte_order order>
+inline __m128i swap_units(__m128i units) noexcept
+{
+    // reverse bytes of every code unit unless the order is native
+
+    if constexpr (size == 1 || order == byte_order::native) {
+        return units;
+    } else if constexpr (size == 2) {
+#if defined(SUTF_SIMD_SSSE3)
+        return _mm_shuffle_epi8(units, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+#else
+        return _mm_or_si128(_mm_slli_epi16(units, 8), _mm_srli_epi16(units, 8));
+#endif
+    } else {
+#if defined(SUTF_SIMD_SSSE3)
+        return _mm_shuffle_epi8(units, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#else
+        const __m128i halves = _mm_or_si128(_mm_slli_epi16(units, 8), _mm_srli_epi16(units, 8));
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(halves, 0xb1), 0xb1);
+#endif
+    }
+}
+#endif // SUTF_SIMD_SSE2
+
+
+
+#if defined(SUTF_SIMD_AVX2)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<uint_t size>
+inline __m256i swap_units(__m256i units) noexcept
+{
+    if constexpr (size == 2)
+        return _mm256_shuffle_epi8(units, _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    else
+        return _mm256_shuffle_epi8(units, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+}
+#endif // SUTF_SIMD_AVX2
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline const char* swap_copy(const char* it, const char* last, char*& dst) noexcept
+{
+    // copy whole 32 byte blocks reversing the byte order of every code unit
+
+#if defined(SUTF_SIMD_AVX2)
+    if constexpr (order != byte_order::native) {
+
+        for (; last - it >= 32; it += 32, dst += 32) {
+
+            const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), swap_units<sizeof(char_t)>(units));
+        }
+    }
+#elif defined(SUTF_SIMD_SSE2)
+    for (; last - it >= 32; it += 32, dst += 32) {
+
+        const __m128i* in = reinterpret_cast<const __m128i*>(it);
+        __m128i* out = reinterpret_cast<__m128i*>(dst);
+
+        _mm_storeu_si128(out + 0, swap_units<sizeof(char_t), order>(_mm_loadu_si128(in + 0)));
+        _mm_storeu_si128(out + 1, swap_units<sizeof(char_t), order>(_mm_loadu_si128(in + 1)));
+    }
+#endif // SUTF_SIMD_SSE2
+
+    if constexpr (order == byte_order::native) {
+
+        // the size is computed once and only for non-empty blocks, so that compilers see it
+        // bounded and empty buffers without data aren't passed to memcpy
+
+        if (last - it >= 32) {
+
+            const uint_t size = static_cast<uint_t>(last - it) / 32 * 32;
+
+            std::memcpy(dst, it, size);
+            dst += size;
+            it += size;
+        }
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline uint_t load_unit(const char* it) noexcept
+{
+    return static_cast<unit_t<char_t>>(*endian_iterator<char_t, order>(it));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline char* store_unit(char* dst, uint_t unit) noexcept
+{
+    for (uint_t index = 0; index != sizeof(char_t); ++index) {
+
+        const uint_t shift = order == byte_order::big ? (sizeof(char_t) - 1 - index) * 8 : index * 8;
+        *dst++ = static_cast<char>((unit >> shift) & 0xff);
+    }
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline uint_t endian_read_code_point(const char*& it, const char* last) noexcept
+{
+    // pairs of surrogates are joined only if complete, otherwise the unit is kept as is
+
+    uint_t cp = load_unit<char_t, order>(it);
+    it += sizeof(char_t);
+
+    if constexpr (sizeof(char_t) == sizeof(char16_t)) {
+
+        if ((cp & 0xfc00) == 0xd800 && last - it >= 2) {
+
+            const uint_t low = load_unit<char_t, order>(it);
+
+            if ((low & 0xfc00) == 0xdc00) {
+
+                cp = 0x10000 + ((cp & 0x3ff) << 10) + (low & 0x3ff);
+                it += sizeof(char_t);
+            }
+        }
+    }
+
+    return cp;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename dst_t>
+inline dst_t* endian_decode_code_point(const char*& it, const char* last, dst_t* dst) noexcept
+{
+    if constexpr (sizeof(dst_t) == sizeof(char_t)) {
+
+        *dst++ = static_cast<dst_t>(load_unit<char_t, order>(it));
+        it += sizeof(char_t);
+
+        return dst;
+
+    } else {
+
+        return code_point_write(dst, endian_read_code_point<char_t, order>(it, last));
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename chardst_t>
+inline uint_t endian_code_unit_count(const char* it, const char* last) noexcept
+{
+    // number of code units written by endian_decode, surrogates are paired by the same rule
+
+    if constexpr (sizeof(chardst_t) == sizeof(char_t)) {
+
+        return (last - it) / sizeof(char_t);
+
+    } else {
+
+        uint_t count = 0;
+
+        while (it < last)
+            count += code_unit_count<chardst_t>(endian_read_code_point<char_t, order>(it, last));
+
+        return count;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename dst_t>
+inline dst_t* endian_decode(const char* it, const char* last, dst_t* dst) noexcept
+{
+    // decode byte ordered code units to native code units, the swap is fused into conversion
+
+    if constexpr (sizeof(dst_t) == sizeof(char_t)) {
+
+        char* out = reinterpret_cast<char*>(dst);
+        it = swap_copy<char_t, order>(it, last, out);
+        dst = reinterpret_cast<dst_t*>(out);
+    }
+
+#if defined(SUTF_SIMD_SSE2)
+    while (last - it >= 16) {
+
+        const __m128i units = swap_units<sizeof(char_t), order>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it)));
+        const __m128i zero = _mm_setzero_si128();
+        __m128i* out = reinterpret_cast<__m128i*>(dst);
+
+        if constexpr (sizeof(dst_t) == sizeof(char_t)) {
+
+            _mm_storeu_si128(out, units);
+            dst += 16 / sizeof(char_t);
+            it += 16;
+            continue;
+
+        } else if constexpr (sizeof(char_t) == 2 && sizeof(dst_t) == 4) {
+
+            const __m128i masked = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xf800)));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(masked, _mm_set1_epi16(static_cast<short>(0xd800)))) == 0) {
+
+                _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(units, zero));
+                _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(units, zero));
+                dst += 8;
+                it += 16;
+                continue;
+            }
+
+        } else if constexpr (sizeof(char_t) == 2 && sizeof(dst_t) == 1) {
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xff80))), zero)) == 0xffff) {
+
+                _mm_storel_epi64(out, _mm_packus_epi16(units, units));
+                dst += 8;
+                it += 16;
+                continue;
+            }
+
+        } else if constexpr (sizeof(char_t) == 4 && sizeof(dst_t) == 2) {
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(static_cast<int>(0xffff0000))), zero)) == 0xffff) {
+
+                const __m128i units16 = _mm_srai_epi32(_mm_slli_epi32(units, 16), 16);
+                _mm_storel_epi64(out, _mm_packs_epi32(units16, units16));
+                dst += 4;
+                it += 16;
+                continue;
+            }
+
+        } else {
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(static_cast<int>(0xffffff80))), zero)) == 0xffff) {
+
+                const __m128i units16 = _mm_packs_epi32(units, units);
+                const std::int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(units16, units16));
+                std::memcpy(dst, &bytes, sizeof(bytes));
+                dst += 4;
+                it += 16;
+                continue;
+            }
+        }
+
+        // the block contains multi unit sequences, decode it one code point at a time
+
+        for (const char* block = it + 16; it < block;)
+            dst = endian_decode_code_point<char_t, order>(it, last, dst);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    while (it < last)
+        dst = endian_decode_code_point<char_t, order>(it, last, dst);
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline char* endian_encode_code_point(uint_t cp, char* dst) noexcept
+{
+    if constexpr (sizeof(char_t) == sizeof(char16_t)) {
+
+        if (cp >= 0x10000) {
+
+            dst = store_unit<char_t, order>(dst, 0xd800 + ((cp - 0x10000) >> 10));
+            return store_unit<char_t, order>(dst, 0xdc00 + ((cp - 0x10000) & 0x3ff));
+        }
+    }
+
+    return store_unit<char_t, order>(dst, cp);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename src_t>
+inline char* endian_encode(const src_t* it, const src_t* last, char* dst) noexcept
+{
+    // encode native code units to byte ordered code units, the swap is fused into conversion
+
+    if constexpr (sizeof(src_t) == sizeof(char_t)) {
+
+        const char* bytes = reinterpret_cast<const char*>(it);
+        it = reinterpret_cast<const src_t*>(swap_copy<char_t, order>(bytes, reinterpret_cast<const char*>(last), dst));
+    }
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(src_t);
+
+    while (last - it >= static_cast<int_t>(block)) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const __m128i zero = _mm_setzero_si128();
+        __m128i* out = reinterpret_cast<__m128i*>(dst);
+
+        if constexpr (sizeof(src_t) == sizeof(char_t)) {
+
+            _mm_storeu_si128(out, swap_units<sizeof(char_t), order>(units));
+            dst += 16;
+            it += block;
+            continue;
+
+        } else if constexpr (sizeof(src_t) == 1) {
+
+            if (_mm_movemask_epi8(units) == 0) {
+
+                const __m128i lo = _mm_unpacklo_epi8(units, zero);
+                const __m128i hi = _mm_unpackhi_epi8(units, zero);
+
+                if constexpr (sizeof(char_t) == 2) {
+                    _mm_storeu_si128(out + 0, swap_units<2, order>(lo));
+                    _mm_storeu_si128(out + 1, swap_units<2, order>(hi));
+                } else {
+                    _mm_storeu_si128(out + 0, swap_units<4, order>(_mm_unpacklo_epi16(lo, zero)));
+                    _mm_storeu_si128(out + 1, swap_units<4, order>(_mm_unpackhi_epi16(lo, zero)));
+                    _mm_storeu_si128(out + 2, swap_units<4, order>(_mm_unpacklo_epi16(hi, zero)));
+                    _mm_storeu_si128(out + 3, swap_units<4, order>(_mm_unpackhi_epi16(hi, zero)));
+                }
+
+                dst += 16 * sizeof(char_t);
+                it += block;
+                continue;
+            }
+
+        } else if constexpr (sizeof(src_t) == 2) {
+
+            const __m128i masked = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xf800)));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(masked, _mm_set1_epi16(static_cast<short>(0xd800)))) == 0) {
+
+                _mm_storeu_si128(out + 0, swap_units<4, order>(_mm_unpacklo_epi16(units, zero)));
+                _mm_storeu_si128(out + 1, swap_units<4, order>(_mm_unpackhi_epi16(units, zero)));
+                dst += 32;
+                it += block;
+                continue;
+            }
+
+        } else {
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(static_cast<int>(0xffff0000))), zero)) == 0xffff) {
+
+                const __m128i units16 = _mm_srai_epi32(_mm_slli_epi32(units, 16), 16);
+                _mm_storel_epi64(out, swap_units<2, order>(_mm_packs_epi32(units16, units16)));
+                dst += 8;
+                it += block;
+                continue;
+            }
+        }
+
+        // the block contains code points which need several code units
+
+        for (const src_t* next = it + block; it < next; it = code_point_next(it))
+            dst = endian_encode_code_point<char_t, order>(code_point_read(it), dst);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it < last; it = code_point_next(it))
+        dst = endian_encode_code_point<char_t, order>(code_point_read(it), dst);
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename chardst_t>
+inline std::basic_string<chardst_t> endian_to_anystring(const endian_view<char_t, order>& str)
+{
+    std::basic_string<chardst_t> out;
+    out.resize(max_code_units<chardst_t, char_t>(str.size()));
+
+    const char* it = str.data();
+    out.resize(endian_decode<char_t, order>(it, it + str.bytes().size(), out.data()) - out.data());
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename charsrc_t>
+inline string anystring_to_endian(const std::basic_string_view<charsrc_t>& str)
+{
+    string out;
+    out.resize(max_code_units<char_t, charsrc_t>(str.size()) * sizeof(char_t));
+    out.resize(endian_encode<char_t, order>(str.data(), str.data() + str.size(), out.data()) - out.data());
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct byte_statistics
+{
+    uint_t zeros[4] = {};
+    uint_t surrogates[2] = {};
+    uint_t non_ascii = 0;
+    uint_t continuations = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline byte_statistics collect_statistics(const char* it, const char* last) noexcept
+{
+    // count zero bytes per position modulo 4, bytes which may be high bytes of UTF-16 surrogates
+    // per position modulo 2, non-ASCII and UTF-8 continuation bytes in a single pass
+
+    byte_statistics stats;
+    uint_t offset = 0;
+
+#if defined(SUTF_SIMD_SSE2)
+    // byte lanes count matches at every position and are flushed before they overflow
+
+    const __m128i zero = _mm_setzero_si128();
+
+    while (last - it >= 16) {
+
+        __m128i zeros = zero;
+        __m128i surrogates = zero;
+        __m128i non_ascii = zero;
+        __m128i continuations = zero;
+
+        for (uint_t count = 0; count != 255 && last - it >= 16; ++count, it += 16, offset += 16) {
+
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            const __m128i high = _mm_and_si128(bytes, _mm_set1_epi8(static_cast<char>(0xf8)));
+
+            zeros = _mm_sub_epi8(zeros, _mm_cmpeq_epi8(bytes, zero));
+            surrogates = _mm_sub_epi8(surrogates, _mm_cmpeq_epi8(high, _mm_set1_epi8(static_cast<char>(0xd8))));
+            non_ascii = _mm_sub_epi8(non_ascii, _mm_cmplt_epi8(bytes, zero));
+            continuations = _mm_sub_epi8(continuations, _mm_cmplt_epi8(bytes, _mm_set1_epi8(static_cast<char>(0xc0))));
+        }
+
+        alignas(16) std::uint8_t lanes[2][16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[0]), zeros);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[1]), surrogates);
+
+        for (uint_t lane = 0; lane != 16; ++lane) {
+
+            stats.zeros[lane % 4] += lanes[0][lane];
+            stats.surrogates[lane % 2] += lanes[1][lane];
+        }
+
+        const __m128i sums = _mm_add_epi64(_mm_sad_epu8(non_ascii, zero), _mm_slli_epi64(_mm_sad_epu8(continuations, zero), 32));
+        alignas(16) std::uint64_t totals[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(totals), sums);
+
+        stats.non_ascii += static_cast<std::uint32_t>(totals[0]) + static_cast<std::uint32_t>(totals[1]);
+        stats.continuations += (totals[0] >> 32) + (totals[1] >> 32);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it < last; ++it, ++offset) {
+
+        const auto byte = static_cast<unsigned char>(*it);
+
+        stats.zeros[offset % 4] += byte == 0;
+        stats.surrogates[offset % 2] += (byte & 0xf8) == 0xd8;
+        stats.non_ascii += byte >= 0x80;
+        stats.continuations += (byte & 0xc0) == 0x80;
+    }
+
+    return stats;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct utf8_transition_table
+{
+    std::uint64_t data[256];
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr utf8_transition_table make_utf8_transition_table() noexcept
+{
+    // shift based DFA, every state is an offset of 6 bit field in the row of the input byte
+    // and the field holds the offset of the next state, so that a step is a single shift
+
+    enum : std::uint64_t { accept, error, tail1, tail2, tail3, e0, ed, f0, f4 };
+
+    utf8_transition_table table = {};
+
+    const auto set = [&table](uint_t first, uint_t last, std::uint64_t from, std::uint64_t to) {
+        for (uint_t byte = first; byte <= last; ++byte)
+            table.data[byte] = (table.data[byte] & ~(std::uint64_t(63) << (from * 6))) | (to * 6) << (from * 6);
+    };
+
+    for (uint_t byte = 0; byte != 256; ++byte)
+        for (std::uint64_t state = 0; state != 9; ++state)
+            table.data[byte] |= (error * 6) << (state * 6);
+
+    set(0x00, 0x7f, accept, accept);
+    set(0xc2, 0xdf, accept, tail1);
+    set(0xe0, 0xe0, accept, e0);
+    set(0xe1, 0xec, accept, tail2);
+    set(0xed, 0xed, accept, ed);
+    set(0xee, 0xef, accept, tail2);
+    set(0xf0, 0xf0, accept, f0);
+    set(0xf1, 0xf3, accept, tail3);
+    set(0xf4, 0xf4, accept, f4);
+
+    set(0x80, 0xbf, tail1, accept);
+    set(0x80, 0xbf, tail2, tail1);
+    set(0x80, 0xbf, tail3, tail2);
+    set(0xa0, 0xbf, e0, tail1);
+    set(0x80, 0x9f, ed, tail1);
+    set(0x90, 0xbf, f0, tail2);
+    set(0x80, 0x8f, f4, tail2);
+
+    return table;
+}
+
+
+
+inline constexpr utf8_transition_table utf8_transitions = make_utf8_transition_table();
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const char* utf8_incomplete_tail(const char* first, const char* last) noexcept
+{
+    // find the beginning of an incomplete sequence at the end of the buffer
+
+    for (uint_t size = 1; size <= 3 && last - first >= static_cast<int_t>(size); ++size) {
+
+        const auto byte = static_cast<unsigned char>(last[-static_cast<int_t>(size)]);
+
+        if (byte < 0x80)
+            break;
+
+        if (byte >= 0xc0)
+            return (byte >= 0xf0 ? 4 : byte >= 0xe0 ? 3 : 2) > size ? last - size : last;
+    }
+
+    return last;
+}
+
+
+
+#if defined(SUTF_SIMD_SSSE3)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const char* utf8_validate_blocks(const char* it, const char* last, bool& valid) noexcept
+{
+    // lookup algorithm by Keiser and Lemire, the first byte of every pair of adjacent bytes is
+    // classified by its high and low nibbles and the second one by its high nibble, a pair is
+    // invalid if all three lookups share an error bit, the error bit 0x80 marks the second or
+    // the third continuation byte and is checked against the leading bytes two and three
+    // positions back
+
+    constexpr char too_short = 1 << 0;
+    constexpr char too_long = 1 << 1;
+    constexpr char overlong_3 = 1 << 2;
+    constexpr char too_large = 1 << 3;
+    constexpr char surrogate = 1 << 4;
+    constexpr char overlong_2 = 1 << 5;
+    constexpr char too_large_1000 = 1 << 6;
+    constexpr char overlong_4 = 1 << 6;
+    constexpr char two_conts = static_cast<char>(1 << 7);
+    constexpr char carry = too_short | too_long | two_conts;
+
+    const __m128i byte_1_high_table = _mm_setr_epi8(
+        too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+        two_conts, two_conts, two_conts, two_conts,
+        too_short | overlong_2,
+        too_short,
+        too_short | overlong_3 | surrogate,
+        too_short | too_large | too_large_1000 | overlong_4);
+
+    const __m128i byte_1_low_table = _mm_setr_epi8(
+        carry | overlong_3 | overlong_2 | overlong_4,
+        carry | overlong_2,
+        carry,
+        carry,
+        carry | too_large,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000);
+
+    const __m128i byte_2_high_table = _mm_setr_epi8(
+        too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_short, too_short, too_short, too_short);
+
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i previous = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+
+    for (; last - it >= 16; it += 16) {
+
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+        if (_mm_movemask_epi8(bytes) == 0 && _mm_movemask_epi8(previous) == 0) {
+
+            previous = bytes;
+            continue;
+        }
+
+        const __m128i prev1 = _mm_alignr_epi8(bytes, previous, 15);
+        const __m128i prev2 = _mm_alignr_epi8(bytes, previous, 14);
+        const __m128i prev3 = _mm_alignr_epi8(bytes, previous, 13);
+
+        const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+        const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble));
+        const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+        const __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+        const __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+        const __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        const __m128i must_continue = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+
+        error = _mm_or_si128(error, _mm_xor_si128(must_continue, special));
+        previous = bytes;
+    }
+
+    valid = _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xffff;
+
+    return it;
+}
+#endif // SUTF_SIMD_SSSE3
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool utf8_valid(const char* it, const char* last) noexcept
+{
+    // check well-formed UTF-8 according to the Unicode standard, blocks are validated by SIMD
+    // kernel and the rest starting from the last sequence boundary by DFA
+
+#if defined(SUTF_SIMD_SSSE3)
+    const char* first = it;
+    bool valid = true;
+    it = utf8_validate_blocks(it, last, valid);
+
+    if (!valid)
+        return false;
+
+    it = utf8_incomplete_tail(first, it);
+#endif // SUTF_SIMD_SSSE3
+
+    std::uint64_t state = 0;
+
+    for (; last - it >= 16; it += 16) {
+
+        // skip ASCII blocks between sequences
+
+        std::uint64_t words[2];
+        std::memcpy(words, it, sizeof(words));
+
+        if (state == 0 && ((words[0] | words[1]) & 0x8080808080808080) == 0)
+            continue;
+
+        for (uint_t index = 0; index != 16; ++index)
+            state = utf8_transitions.data[static_cast<unsigned char>(it[index])] >> state & 63;
+    }
+
+    for (; it != last; ++it)
+        state = utf8_transitions.data[static_cast<unsigned char>(*it)] >> state & 63;
+
+    return state == 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<byte_order order>
+inline bool utf16_valid(const char* it, const char* last, bool truncated) noexcept
+{
+    // check that every surrogate is paired
+
+    for (; last - it >= 2; it += 2) {
+
+        const uint_t unit = load_unit<char16_t, order>(it);
+
+        if ((unit & 0xfc00) == 0xdc00)
+            return false;
+
+        if ((unit & 0xfc00) == 0xd800) {
+
+            if (last - it < 4)
+                return truncated;
+
+            if ((load_unit<char16_t, order>(it + 2) & 0xfc00) != 0xdc00)
+                return false;
+
+            it += 2;
+        }
+    }
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<byte_order order>
+inline bool utf32_valid(const char* it, const char* last) noexcept
+{
+    for (; last - it >= 4; it += 4) {
+
+        const uint_t unit = load_unit<char32_t, order>(it);
+
+        if (unit > 0x10ffff || (unit & 0xfffff800) == 0xd800)
+            return false;
+    }
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t byte_diversity(const char* it, const char* last, uint_t parity) noexcept
+{
+    // number of distinct byte values at even or odd positions
+
+    std::uint64_t seen[4] = {};
+
+    for (it += parity; last - it >= 1; it += 2) {
+
+        const auto byte = static_cast<unsigned char>(*it);
+        seen[byte / 64] |= std::uint64_t(1) << (byte % 64);
+
+        if (last - it < 2)
+            break;
+    }
+
+    return bit_count(seen[0]) + bit_count(seen[1]) + bit_count(seen[2]) + bit_count(seen[3]);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline detection detect_bom(const string_view& bytes) noexcept
+{
+    // UTF-32LE mark starts with UTF-16LE one, so it's checked first
+
+    if (bytes.substr(0, 4) == string_view("\xff\xfe\x00\x00", 4))
+        return { encoding::utf32le, 4, 1 };
+    if (bytes.substr(0, 4) == string_view("\x00\x00\xfe\xff", 4))
+        return { encoding::utf32be, 4, 1 };
+    if (bytes.substr(0, 3) == string_view("\xef\xbb\xbf", 3))
+        return { encoding::utf8, 3, 1 };
+    if (bytes.substr(0, 2) == string_view("\xff\xfe", 2))
+        return { encoding::utf16le, 2, 1 };
+    if (bytes.substr(0, 2) == string_view("\xfe\xff", 2))
+        return { encoding::utf16be, 2, 1 };
+
+    return {};
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Latin-1 source convertors
+
+inline string to_string(const latin1_view& str)
+{
+    return to_anystring<char>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline wstring to_wstring(const latin1_view& str)
+{
+    return to_anystring<wchar_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline u8string to_u8string(const latin1_view& str)
+{
+    return to_anystring<char8s_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline u16string to_u16string(const latin1_view& str)
+{
+    return to_anystring<char16_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline u32string to_u32string(const latin1_view& str)
+{
+    return to_anystring<char32_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t>
+inline std::basic_string<chardst_t> to_anystring(const latin1_view& str)
+{
+    std::basic_string<chardst_t> out;
+    out.resize(impl::latin1_size<chardst_t>(str));
+
+    impl::latin1_to_any(str.data(), str.data() + str.size(), out.data());
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto convert(const latin1_view& src, type_t& dst) -> decltype(std::begin(dst), std::end(dst), uint_t())
+{
+    using chardst_t = typename std::iterator_traits<decltype(std::begin(dst))>::value_type;
+    const uint_t dst_size = impl::latin1_size<chardst_t>(src);
+
+    if (std::size(dst) < dst_size)
+        throw std::length_error("Destination buffer doesn't fit on the specified string after convertion.");
+
+    if constexpr (impl::is_contiguous_v<type_t>)
+        impl::latin1_to_any(src.data(), src.data() + src.size(), std::data(dst));
+    else
+        code_point_convert(src.cbegin(), src.cend(), std::begin(dst));
+
+    return dst_size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Latin-1 destination convertors
+
+inline string to_latin1(const string_view& str)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const wstring_view& str)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const u8string_view& str)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const u16string_view& str)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const u32string_view& str)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_native_string_v<type_t>, int>>
+inline string to_latin1(const type_t& str)
+{
+    if constexpr (is_char_array_v<type_t>)
+        return to_latin1(std::basic_string_view(str, std::size(str) - 1));
+    else
+        return to_latin1(std::basic_string_view(str));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline string to_latin1(const std::basic_string_view<char_t>& str)
+{
+    return impl::to_latin1(str, nullptr);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const string_view& str, char replacement)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str, replacement);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const wstring_view& str, char replacement)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str, replacement);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const u8string_view& str, char replacement)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str, replacement);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const u16string_view& str, char replacement)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str, replacement);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline string to_latin1(const u32string_view& str, char replacement)
+{
+    return to_latin1<typename std::iterator_traits<decltype(std::cbegin(str))>::value_type>(str, replacement);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_native_string_v<type_t>, int>>
+inline string to_latin1(const type_t& str, char replacement)
+{
+    if constexpr (is_char_array_v<type_t>)
+        return to_latin1(std::basic_string_view(str, std::size(str) - 1), replacement);
+    else
+        return to_latin1(std::basic_string_view(str), replacement);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline string to_latin1(const std::basic_string_view<char_t>& str, char replacement)
+{
+    return impl::to_latin1(str, &replacement);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// byte ordered UTF-16/UTF-32 source convertors
+
+template<typename char_t, byte_order order>
+inline string to_string(const endian_view<char_t, order>& str)
+{
+    return to_anystring<char>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline wstring to_wstring(const endian_view<char_t, order>& str)
+{
+    return to_anystring<wchar_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline u8string to_u8string(const endian_view<char_t, order>& str)
+{
+    return to_anystring<char8s_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline u16string to_u16string(const endian_view<char_t, order>& str)
+{
+    return to_anystring<char16_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order>
+inline u32string to_u32string(const endian_view<char_t, order>& str)
+{
+    return to_anystring<char32_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename char_t, byte_order order>
+inline std::basic_string<chardst_t> to_anystring(const endian_view<char_t, order>& str)
+{
+    return impl::endian_to_anystring<char_t, order, chardst_t>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename type_t>
+inline auto convert(const endian_view<char_t, order>& src, type_t& dst) -> decltype(std::begin(dst), std::end(dst), uint_t())
+{
+    using chardst_t = typename std::iterator_traits<decltype(std::begin(dst))>::value_type;
+    const char* first = src.data();
+    const char* last = first + src.bytes().size();
+    const uint_t dst_size = impl::endian_code_unit_count<char_t, order, chardst_t>(first, last);
+
+    if (std::size(dst) < dst_size)
+        throw std::length_error("Destination buffer doesn't fit on the specified string after convertion.");
+
+    if constexpr (impl::is_contiguous_v<type_t>) {
+
+        impl::endian_decode<char_t, order>(first, last, std::data(dst));
+
+    } else {
+
+        // code points are decoded by the same rule as for contiguous destinations
+
+        auto out = std::begin(dst);
+
+        while (first < last) {
+
+            chardst_t units[4];
+            out = std::copy(units, impl::endian_decode_code_point<char_t, order>(first, last, units), out);
+        }
+    }
+
+    return dst_size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// byte ordered UTF-16/UTF-32 destination convertors
+
+template<typename type_t>
+inline string to_utf16le(const type_t& str)
+{
+    return to_endian<char16_t, byte_order::little>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline string to_utf16be(const type_t& str)
+{
+    return to_endian<char16_t, byte_order::big>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline string to_utf32le(const type_t& str)
+{
+    return to_endian<char32_t, byte_order::little>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline string to_utf32be(const type_t& str)
+{
+    return to_endian<char32_t, byte_order::big>(str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, byte_order order, typename type_t>
+inline string to_endian(const type_t& str)
+{
+    return impl::anystring_to_endian<char_t, order>(impl::view_of(str));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// encoding detection
+
+inline detection detect_encoding(const string_view& bytes, uint_t max_size) noexcept
+{
+    if (const detection result = impl::detect_bom(bytes); result.type != encoding::unknown)
+        return result;
+
+    if (bytes.empty())
+        return { encoding::utf8, 0, 0 };
+
+    const char* it = bytes.data();
+    const char* last = it + std::min(bytes.size(), max_size);
+    const uint_t size = last - it;
+
+    const impl::byte_statistics stats = impl::collect_statistics(it, last);
+    const uint_t zeros = stats.zeros[0] + stats.zeros[1] + stats.zeros[2] + stats.zeros[3];
+
+    detection result;
+
+    const auto propose = [&result](encoding type, float confidence) {
+        if (confidence > result.confidence)
+            result = { type, 0, confidence };
+    };
+
+    // text encoded by 8 bit units rarely contains zero bytes, the confidence grows with the number
+    // of multibyte sequences, the sequence cut by the examined prefix is ignored
+
+    const char* valid_last = bytes.size() > max_size ? impl::utf8_incomplete_tail(it, last) : last;
+    const bool utf8 = zeros * 100 <= size && impl::utf8_valid(it, valid_last);
+
+    if (utf8) {
+
+        const uint_t sequences = stats.non_ascii - stats.continuations;
+        const float confidence = sequences == 0 ? 0.6f : 1.0f - 0.25f / static_cast<float>(sequences);
+
+        propose(encoding::utf8, zeros == 0 ? confidence : confidence / 2);
+
+    } else if (zeros == 0) {
+
+        propose(encoding::latin1, 0.4f);
+    }
+
+    // text encoded by wide units contains zero high bytes for ASCII and most of alphabetic code
+    // points, all units have zero high byte in UTF-32
+
+    const uint_t units16 = size / 2;
+    const uint_t units32 = size / 4;
+
+    if (units32 != 0 && stats.zeros[3] == units32 && stats.zeros[2] * 2 >= units32 && impl::utf32_valid<byte_order::little>(it, last))
+        propose(encoding::utf32le, 0.99f);
+
+    if (units32 != 0 && stats.zeros[0] == units32 && stats.zeros[1] * 2 >= units32 && impl::utf32_valid<byte_order::big>(it, last))
+        propose(encoding::utf32be, 0.99f);
+
+    if (units16 == 0)
+        return result.type == encoding::unknown ? detection { encoding::latin1, 0, 0.1f } : result;
+
+    // byte order of UTF-16 is decided by zero bytes distribution, if there are no zero bytes then
+    // high bytes of UTF-16 code units have much less distinct values than low ones, paired
+    // surrogates are evidence of UTF-16 while unpaired ones exclude it
+
+    const uint_t even = stats.zeros[0] + stats.zeros[2];
+    const uint_t odd = stats.zeros[1] + stats.zeros[3];
+    float balance = static_cast<float>(even > odd ? even - odd : odd - even) / static_cast<float>(units16);
+    bool little = odd >= even;
+
+    if (zeros == 0 && !utf8 && stats.non_ascii != 0) {
+
+        const uint_t even_diversity = impl::byte_diversity(it, last, 0);
+        const uint_t odd_diversity = impl::byte_diversity(it, last, 1);
+
+        balance = 1.0f - static_cast<float>(std::min(even_diversity, odd_diversity)) / static_cast<float>(std::max(even_diversity, odd_diversity));
+        little = odd_diversity < even_diversity;
+    }
+
+    const bool truncated = bytes.size() > max_size;
+    const uint_t surrogates = stats.surrogates[little ? 1 : 0];
+
+    const bool valid = little
+        ? surrogates == 0 || impl::utf16_valid<byte_order::little>(it, last, truncated)
+        : surrogates == 0 || impl::utf16_valid<byte_order::big>(it, last, truncated);
+
+    if (valid)
+        propose(little ? encoding::utf16le : encoding::utf16be, std::min(0.3f + 0.69f * balance + (surrogates != 0 ? 0.2f : 0.0f), 0.99f));
+
+    return result.type == encoding::unknown ? detection { encoding::latin1, 0, 0.1f } : result;
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_encoding.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,637 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+#include "utf_unicode_tables.h"
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// forward iterator over extended grapheme clusters of contiguous string, clusters are views of
+// the string
+
+template<typename char_t>
+class grapheme_iterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::basic_string_view<char_t>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = value_type;
+
+public:
+    grapheme_iterator() noexcept = default;
+    grapheme_iterator(const char_t* it, const char_t* last) noexcept;
+
+    value_type operator*() const noexcept;
+    grapheme_iterator& operator++() noexcept;
+    grapheme_iterator operator++(int) noexcept;
+
+    bool operator==(const grapheme_iterator& other) const noexcept;
+    bool operator!=(const grapheme_iterator& other) const noexcept;
+
+private:
+    const char_t* m_it = nullptr;
+    const char_t* m_next = nullptr;
+    const char_t* m_last = nullptr;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme_range
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// range of grapheme clusters for range based for loops
+
+template<typename char_t>
+class grapheme_range
+{
+public:
+    grapheme_range(const char_t* it, const char_t* last) noexcept;
+
+    grapheme_iterator<char_t> begin() const noexcept;
+    grapheme_iterator<char_t> end() const noexcept;
+
+private:
+    const char_t* m_it;
+    const char_t* m_last;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// end of extended grapheme cluster starting at the iterator (UAX #29)
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int> = 0>
+it_t grapheme_next(it_t it, const it_t last) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme clusters of contiguous string and their count
+
+template<typename type_t>
+auto graphemes(const type_t& str) noexcept -> grapheme_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>;
+template<typename type_t>
+auto grapheme_count(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// display width in terminal columns, wide and fullwidth East Asian characters and emoji take two
+// columns, marks, format and control characters take none, width of grapheme cluster is the
+// width of its first code point, emoji presentation sequences and flags take two columns
+
+constexpr uint_t code_point_width(uint_t cp) noexcept;
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int> = 0>
+uint_t display_width(it_t it, const it_t last) noexcept;
+template<typename type_t>
+auto display_width(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// the longest prefix of contiguous string which fits the display width, grapheme clusters aren't
+// split
+
+template<typename type_t>
+auto truncate_to_width(const type_t& str, uint_t width) noexcept -> std::basic_string_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme properties of code point, see tools/unicode_tables.py
+
+enum class grapheme_break : std::uint8_t
+{
+    other,
+    cr,
+    lf,
+    control,
+    extend,
+    zwj,
+    regional_indicator,
+    prepend,
+    spacing_mark,
+    l,
+    v,
+    t,
+    lv,
+    lvt,
+};
+
+constexpr std::uint8_t grapheme_break_mask = 0x0f;
+constexpr std::uint8_t grapheme_pictographic = 0x10;
+constexpr uint_t grapheme_width_shift = 5;
+
+constexpr std::uint8_t grapheme_of(uint_t cp) noexcept
+{
+    return cp < 0x110000 ? grapheme_lookup(cp) : 1 << grapheme_width_shift;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class grapheme_state
+{
+    // state of grapheme cluster boundary rules, tracks regional indicator pairs and emoji zero
+    // width joiner sequences
+
+public:
+    explicit grapheme_state(std::uint8_t properties) noexcept
+    {
+        update(properties);
+    }
+
+    bool continues(std::uint8_t properties) const noexcept
+    {
+        const grapheme_break prev = m_break;
+        const grapheme_break cur = static_cast<grapheme_break>(properties & grapheme_break_mask);
+
+        if (prev == grapheme_break::cr && cur == grapheme_break::lf)
+            return true;
+
+        if (is_control(prev) || is_control(cur))
+            return false;
+
+        switch (prev) {
+
+        case grapheme_break::l:
+            if (cur == grapheme_break::l || cur == grapheme_break::v || cur == grapheme_break::lv || cur == grapheme_break::lvt)
+                return true;
+            break;
+
+        case grapheme_break::lv:
+        case grapheme_break::v:
+            if (cur == grapheme_break::v || cur == grapheme_break::t)
+                return true;
+            break;
+
+        case grapheme_break::lvt:
+        case grapheme_break::t:
+            if (cur == grapheme_break::t)
+                return true;
+            break;
+
+        case grapheme_break::prepend:
+            return true;
+
+        default:
+            break;
+        }
+
+        if (cur == grapheme_break::extend || cur == grapheme_break::zwj || cur == grapheme_break::spacing_mark)
+            return true;
+
+        if (prev == grapheme_break::zwj && m_emoji == emoji_joined && (properties & grapheme_pictographic) != 0)
+            return true;
+
+        return prev == grapheme_break::regional_indicator && cur == grapheme_break::regional_indicator && m_indicators % 2 == 1;
+    }
+
+    void update(std::uint8_t properties) noexcept
+    {
+        m_break = static_cast<grapheme_break>(properties & grapheme_break_mask);
+        m_indicators = m_break == grapheme_break::regional_indicator ? m_indicators + 1 : 0;
+
+        if ((properties & grapheme_pictographic) != 0)
+            m_emoji = emoji_started;
+        else if (m_emoji == emoji_started && m_break == grapheme_break::extend)
+            m_emoji = emoji_started;
+        else if (m_emoji == emoji_started && m_break == grapheme_break::zwj)
+            m_emoji = emoji_joined;
+        else
+            m_emoji = emoji_none;
+    }
+
+private:
+    static bool is_control(grapheme_break value) noexcept
+    {
+        return value == grapheme_break::cr || value == grapheme_break::lf || value == grapheme_break::control;
+    }
+
+private:
+    static constexpr int emoji_none = 0;
+    static constexpr int emoji_started = 1;
+    static constexpr int emoji_joined = 2;
+
+    grapheme_break m_break = grapheme_break::other;
+    uint_t m_indicators = 0;
+    int m_emoji = emoji_none;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline it_t grapheme_end(it_t it, const it_t last, uint_t& width) noexcept
+{
+    // end of grapheme cluster and its display width, code point truncated by the end of string
+    // is a cluster of width 1
+
+    using char_t = typename std::iterator_traits<it_t>::value_type;
+
+    const uint_t unit = static_cast<unit_t<char_t>>(*it);
+    it_t next = it;
+
+    // boundary between two ASCII characters is always there, except CR LF
+
+    if (unit < 0x80 && unit != '\r' && (++next == last || static_cast<unit_t<char_t>>(*next) < 0x80)) {
+
+        width = unit >= 0x20 && unit < 0x7f;
+        return next;
+    }
+
+    next = code_point_next(it);
+
+    if (last - next <= 0) {
+
+        width = last - next < 0 ? 1 : code_point_width(code_point_read(it));
+        return last;
+    }
+
+    const std::uint8_t first = grapheme_of(code_point_read(it));
+    const bool emoji = (first & grapheme_pictographic) != 0 || (first & grapheme_break_mask) == static_cast<std::uint8_t>(grapheme_break::regional_indicator);
+    grapheme_state state(first);
+
+    width = first >> grapheme_width_shift;
+
+    for (it = next; it != last; it = next) {
+
+        next = code_point_next(it);
+
+        if (last - next < 0)
+            break;
+
+        const uint_t cp = code_point_read(it);
+        const std::uint8_t properties = grapheme_of(cp);
+
+        if (!state.continues(properties))
+            break;
+
+        // emoji presentation selector and the second regional indicator of flag widen cluster
+
+        if (emoji && (cp == 0xfe0f || (properties & grapheme_break_mask) == static_cast<std::uint8_t>(grapheme_break::regional_indicator)))
+            width = 2;
+
+        state.update(properties);
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* printable_ascii_end(const char_t* it, const char_t* last) noexcept
+{
+    // end of run of printable ASCII characters, every one is grapheme cluster of width 1
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    for (; last - it >= static_cast<int_t>(block); it += block) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        __m128i outside;
+
+        if constexpr (sizeof(char_t) == 1) {
+
+            const __m128i shifted = _mm_sub_epi8(units, _mm_set1_epi8(0x20));
+            outside = _mm_xor_si128(_mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(0x5e)), shifted), _mm_set1_epi8(-1));
+
+        } else if constexpr (sizeof(char_t) == 2) {
+
+            outside = _mm_or_si128(_mm_cmplt_epi16(units, _mm_set1_epi16(0x20)), _mm_cmpgt_epi16(units, _mm_set1_epi16(0x7e)));
+
+        } else {
+
+            outside = _mm_or_si128(_mm_cmplt_epi32(units, _mm_set1_epi32(0x20)), _mm_cmpgt_epi32(units, _mm_set1_epi32(0x7e)));
+        }
+
+        const std::uint32_t mask = _mm_movemask_epi8(outside);
+
+        if (mask != 0)
+            return it + bit_scan(mask) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it) {
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*it);
+
+        if (unit < 0x20 || unit >= 0x7f)
+            break;
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t>
+inline it_t printable_ascii_prefix(it_t it, const it_t last) noexcept
+{
+    // printable ASCII run without its last character, which may start cluster with following
+    // combining characters
+
+    if constexpr (std::is_pointer_v<it_t>) {
+
+        using char_t = typename std::iterator_traits<it_t>::value_type;
+
+        // the first two units are checked before the bulk kernel, so that text without ASCII
+        // runs doesn't pay for block loads
+
+        const auto printable = [](char_t unit) {
+            return static_cast<unit_t<char_t>>(unit) - 0x20u < 0x5fu;
+        };
+
+        if (last - it < 2 || !printable(it[0]) || !printable(it[1]))
+            return it;
+
+        const it_t run = printable_ascii_end(it + 2, last);
+
+        if (run - it >= 2)
+            return run - 1;
+    }
+
+    return it;
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline grapheme_iterator<char_t>::grapheme_iterator(const char_t* it, const char_t* last) noexcept
+    : m_it(it)
+    , m_next(it)
+    , m_last(last)
+{
+    if (m_it != m_last)
+        m_next = grapheme_next(m_it, m_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename grapheme_iterator<char_t>::value_type grapheme_iterator<char_t>::operator*() const noexcept
+{
+    return value_type(m_it, m_next - m_it);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline grapheme_iterator<char_t>& grapheme_iterator<char_t>::operator++() noexcept
+{
+    m_it = m_next;
+
+    if (m_it != m_last)
+        m_next = grapheme_next(m_it, m_last);
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline grapheme_iterator<char_t> grapheme_iterator<char_t>::operator++(int) noexcept
+{
+    grapheme_iterator result = *this;
+    ++*this;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool grapheme_iterator<char_t>::operator==(const grapheme_iterator& other) const noexcept
+{
+    return m_it == other.m_it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool grapheme_iterator<char_t>::operator!=(const grapheme_iterator& other) const noexcept
+{
+    return m_it != other.m_it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme_range
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline grapheme_range<char_t>::grapheme_range(const char_t* it, const char_t* last) noexcept
+    : m_it(it)
+    , m_last(last)
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline grapheme_iterator<char_t> grapheme_range<char_t>::begin() const noexcept
+{
+    return grapheme_iterator<char_t>(m_it, m_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline grapheme_iterator<char_t> grapheme_range<char_t>::end() const noexcept
+{
+    return grapheme_iterator<char_t>(m_last, m_last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
+inline it_t grapheme_next(it_t it, const it_t last) noexcept
+{
+    uint_t width;
+
+    return impl::grapheme_end(it, last, width);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto graphemes(const type_t& str) noexcept -> grapheme_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be iterated by grapheme clusters.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    return grapheme_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>(first, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto grapheme_count(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t())
+{
+    auto [it, last] = impl::code_units_of(str);
+    uint_t count = 0;
+
+    while (it != last) {
+
+        const auto run = impl::printable_ascii_prefix(it, last);
+
+        count += run - it;
+        it = grapheme_next(run, last);
+        ++count;
+    }
+
+    return count;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint_t code_point_width(uint_t cp) noexcept
+{
+    return impl::grapheme_of(cp) >> impl::grapheme_width_shift;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
+inline uint_t display_width(it_t it, const it_t last) noexcept
+{
+    uint_t result = 0;
+
+    while (it != last) {
+
+        const it_t run = impl::printable_ascii_prefix(it, last);
+        uint_t width;
+
+        result += run - it;
+        it = impl::grapheme_end(run, last, width);
+        result += width;
+    }
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto display_width(const type_t& str) noexcept -> decltype(std::cbegin(str), uint_t())
+{
+    const auto [first, last] = impl::code_units_of(str);
+
+    return display_width(first, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto truncate_to_width(const type_t& str, uint_t width) noexcept -> std::basic_string_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be truncated.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    auto it = first;
+    uint_t used = 0;
+
+    while (it != last) {
+
+        // printable ASCII characters are taken in bulk
+
+        const auto run = impl::printable_ascii_prefix(it, last);
+        const uint_t size = std::min<uint_t>(run - it, width - used);
+
+        it += size;
+        used += size;
+
+        if (it != run)
+            break;
+
+        uint_t cluster_width;
+        const auto next = impl::grapheme_end(it, last, cluster_width);
+
+        if (used + cluster_width > width)
+            break;
+
+        used += cluster_width;
+        it = next;
+    }
+
+    return std::basic_string_view(first, it - first);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_grapheme.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
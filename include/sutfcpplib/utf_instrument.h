@@ -0,0 +1,322 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_codepoint.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// instrumentation of high-level converters and bulk kernels is compiled in when
+// SUTF_INSTRUMENTATION is defined for the whole program, otherwise probes expand to nothing
+
+#if defined(SUTF_INSTRUMENTATION)
+#define SUTF_INSTRUMENT_CONVERSION(chardst_t, it, last) sutf::impl::conversion_probe<chardst_t> sutf_probe(it, last)
+#define SUTF_INSTRUMENT_RESULT(size) sutf_probe.finish(size)
+#define SUTF_INSTRUMENT_KERNEL(tier, units) sutf::impl::count_kernel_units(tier, units)
+#else
+#define SUTF_INSTRUMENT_CONVERSION(chardst_t, it, last)
+#define SUTF_INSTRUMENT_RESULT(size)
+#define SUTF_INSTRUMENT_KERNEL(tier, units)
+#endif // SUTF_INSTRUMENTATION
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// implementation of bulk kernel selected at compile time
+
+enum class kernel_tier { scalar, sse2, ssse3, avx2 };
+
+// counters of conversions in one direction, time is measured in nanoseconds
+
+struct conversion_statistics
+{
+    std::uint64_t calls = 0;
+    std::uint64_t bytes_in = 0;
+    std::uint64_t bytes_out = 0;
+    std::uint64_t nanoseconds = 0;
+};
+
+// counters aggregated over all threads, conversions are indexed by widths of source and
+// destination code units, code points are counted by length of their UTF-8 representation,
+// code units passed to bulk kernels are counted by kernel tier
+
+struct instrumentation_snapshot
+{
+    conversion_statistics conversions[3][3];
+    std::uint64_t code_point_widths[4] = {};
+    std::uint64_t kernel_units[4] = {};
+
+    template<typename charsrc_t, typename chardst_t>
+    const conversion_statistics& conversion() const noexcept;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// current values of instrumentation counters, all zeros if instrumentation isn't compiled in
+
+instrumentation_snapshot snapshot_instrumentation();
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// counters layout: conversions by source and destination width, code point widths, kernel tiers
+
+constexpr uint_t conversion_counters = 4;
+constexpr uint_t widths_offset = 3 * 3 * conversion_counters;
+constexpr uint_t kernels_offset = widths_offset + 4;
+constexpr uint_t counter_count = kernels_offset + 4;
+
+template<typename char_t>
+constexpr uint_t width_index = sizeof(char_t) == 1 ? 0 : sizeof(char_t) == 2 ? 1 : 2;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct thread_counters
+{
+    // counters are written by the owning thread only, so that increment doesn't need locked
+    // instruction, atomics make concurrent snapshots well defined
+
+    std::atomic<std::uint64_t> values[counter_count] = {};
+
+    void add(uint_t index, std::uint64_t value) noexcept
+    {
+        values[index].store(values[index].load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class instrumentation_registry
+{
+    // counters of live threads and sums of counters of finished threads
+
+public:
+    static instrumentation_registry& instance()
+    {
+        static instrumentation_registry registry;
+
+        return registry;
+    }
+
+    void attach(thread_counters* counters)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        m_threads.push_back(counters);
+    }
+
+    void detach(thread_counters* counters) noexcept
+    {
+        const std::lock_guard lock(m_mutex);
+
+        for (uint_t index = 0; index != counter_count; ++index)
+            m_retired[index] += counters->values[index].load(std::memory_order_relaxed);
+
+        m_threads.erase(std::find(m_threads.begin(), m_threads.end(), counters));
+    }
+
+    void collect(std::uint64_t (&values)[counter_count])
+    {
+        const std::lock_guard lock(m_mutex);
+
+        for (uint_t index = 0; index != counter_count; ++index) {
+
+            values[index] = m_retired[index];
+
+            for (const thread_counters* counters : m_threads)
+                values[index] += counters->values[index].load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<thread_counters*> m_threads;
+    std::uint64_t m_retired[counter_count] = {};
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline thread_counters& local_counters()
+{
+    struct owner
+    {
+        thread_counters counters;
+
+        owner()
+        {
+            instrumentation_registry::instance().attach(&counters);
+        }
+
+        ~owner()
+        {
+            instrumentation_registry::instance().detach(&counters);
+        }
+    };
+
+    thread_local owner local;
+
+    return local.counters;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void count_kernel_units(kernel_tier tier, uint_t units)
+{
+    local_counters().add(kernels_offset + static_cast<uint_t>(tier), units);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t>
+class conversion_probe
+{
+    // counts conversion call, its input and output, and measures its time
+
+public:
+    template<typename it_t>
+    conversion_probe(it_t it, const it_t last)
+        : m_counters(local_counters())
+        , m_offset(conversion_offset<typename std::iterator_traits<it_t>::value_type>())
+    {
+        using charsrc_t = typename std::iterator_traits<it_t>::value_type;
+        std::uint64_t widths[4] = {};
+
+        m_counters.add(m_offset + 1, (last - it) * sizeof(charsrc_t));
+
+        for (; last - it > 0; it = code_point_next(it))
+            ++widths[code_unit_count<char>(code_point_read(it)) - 1];
+
+        for (uint_t index = 0; index != 4; ++index)
+            m_counters.add(widths_offset + index, widths[index]);
+
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    void finish(uint_t size) noexcept
+    {
+        const auto time = std::chrono::steady_clock::now() - m_start;
+
+        m_counters.add(m_offset, 1);
+        m_counters.add(m_offset + 2, size * sizeof(chardst_t));
+        m_counters.add(m_offset + 3, std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+    }
+
+private:
+    template<typename charsrc_t>
+    static constexpr uint_t conversion_offset() noexcept
+    {
+        return (width_index<charsrc_t> * 3 + width_index<chardst_t>) * conversion_counters;
+    }
+
+private:
+    thread_counters& m_counters;
+    const uint_t m_offset;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// instrumentation_snapshot
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename charsrc_t, typename chardst_t>
+inline const conversion_statistics& instrumentation_snapshot::conversion() const noexcept
+{
+    return conversions[impl::width_index<charsrc_t>][impl::width_index<chardst_t>];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline instrumentation_snapshot snapshot_instrumentation()
+{
+    instrumentation_snapshot result;
+
+#if defined(SUTF_INSTRUMENTATION)
+    std::uint64_t values[impl::counter_count];
+    impl::instrumentation_registry::instance().collect(values);
+
+    for (uint_t src = 0; src != 3; ++src) {
+
+        for (uint_t dst = 0; dst != 3; ++dst) {
+
+            const std::uint64_t* counters = values + (src * 3 + dst) * impl::conversion_counters;
+            result.conversions[src][dst] = { counters[0], counters[1], counters[2], counters[3] };
+        }
+    }
+
+    for (uint_t index = 0; index != 4; ++index) {
+
+        result.code_point_widths[index] = values[impl::widths_offset + index];
+        result.kernel_units[index] = values[impl::kernels_offset + index];
+    }
+#endif // SUTF_INSTRUMENTATION
+
+    return result;
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_instrument.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,383 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// minimal escaping replaces quotation mark, reverse solidus and control characters only, ASCII
+// escaping replaces also non ASCII code points with \u escapes, using surrogate pairs for code
+// points above U+FFFF
+
+enum class json_escape_mode { minimal, ascii };
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// escape content of JSON string, source and destination may have different encodings, the second
+// form appends to the destination string
+
+template<typename chardst_t, typename type_t>
+auto json_escape(const type_t& str, json_escape_mode mode = json_escape_mode::minimal) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+template<typename chardst_t, typename type_t>
+auto json_escape(const type_t& str, std::basic_string<chardst_t>& out, json_escape_mode mode = json_escape_mode::minimal) -> decltype(std::cbegin(str), void());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// unescape content of JSON string, \u escapes of surrogate pairs are joined to one code point,
+// unpaired surrogates are replaced with U+FFFD, malformed escape throws std::invalid_argument
+
+template<typename chardst_t, typename type_t>
+auto json_unescape(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+template<typename chardst_t, typename type_t>
+auto json_unescape(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), void());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* json_clean_end(const char_t* it, const char_t* last, bool ascii) noexcept
+{
+    // find first code unit which must be escaped: quotation mark, reverse solidus, control
+    // character or non ASCII unit in ASCII mode
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    for (; last - it >= static_cast<int_t>(block); it += block) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        __m128i special;
+
+        if constexpr (sizeof(char_t) == 1) {
+
+            special = _mm_or_si128(_mm_cmpeq_epi8(units, _mm_set1_epi8('"')), _mm_cmpeq_epi8(units, _mm_set1_epi8('\\')));
+            special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_min_epu8(units, _mm_set1_epi8(0x1f)), units));
+
+            if (ascii)
+                special = _mm_or_si128(special, units);
+
+        } else if constexpr (sizeof(char_t) == 2) {
+
+            special = _mm_or_si128(_mm_cmpeq_epi16(units, _mm_set1_epi16('"')), _mm_cmpeq_epi16(units, _mm_set1_epi16('\\')));
+            special = _mm_or_si128(special, _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xffe0))), _mm_setzero_si128()));
+
+            if (ascii)
+                special = _mm_or_si128(special, _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xff80))), _mm_setzero_si128()), _mm_set1_epi16(-1)));
+
+        } else {
+
+            special = _mm_or_si128(_mm_cmpeq_epi32(units, _mm_set1_epi32('"')), _mm_cmpeq_epi32(units, _mm_set1_epi32('\\')));
+            special = _mm_or_si128(special, _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(~0x1f)), _mm_setzero_si128()));
+
+            if (ascii)
+                special = _mm_or_si128(special, _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(~0x7f)), _mm_setzero_si128()), _mm_set1_epi32(-1)));
+        }
+
+        const std::uint32_t mask = _mm_movemask_epi8(special);
+
+        if (mask != 0)
+            return it + bit_scan(mask) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it) {
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*it);
+
+        if (unit == '"' || unit == '\\' || unit < 0x20 || (ascii && unit >= 0x80))
+            break;
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t>
+inline void json_append_escape(std::basic_string<chardst_t>& out, uint_t cp)
+{
+    constexpr char digits[] = "0123456789abcdef";
+    chardst_t escape[12];
+    chardst_t* dst = escape;
+
+    const auto append_unit = [&dst, &digits](uint_t unit) {
+
+        *dst++ = '\\';
+        *dst++ = 'u';
+
+        for (int shift = 12; shift >= 0; shift -= 4)
+            *dst++ = digits[(unit >> shift) & 0xf];
+    };
+
+    switch (cp) {
+
+    case '"': *dst++ = '\\'; *dst++ = '"'; break;
+    case '\\': *dst++ = '\\'; *dst++ = '\\'; break;
+    case '\b': *dst++ = '\\'; *dst++ = 'b'; break;
+    case '\f': *dst++ = '\\'; *dst++ = 'f'; break;
+    case '\n': *dst++ = '\\'; *dst++ = 'n'; break;
+    case '\r': *dst++ = '\\'; *dst++ = 'r'; break;
+    case '\t': *dst++ = '\\'; *dst++ = 't'; break;
+
+    default:
+
+        if (cp < 0x10000) {
+
+            append_unit(cp);
+
+        } else {
+
+            append_unit(0xd800 + ((cp - 0x10000) >> 10));
+            append_unit(0xdc00 + ((cp - 0x10000) & 0x3ff));
+        }
+    }
+
+    out.append(escape, dst - escape);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t json_hex(const char_t* it, const char_t* last)
+{
+    // value of 4 hexadecimal digits
+
+    if (last - it < 4)
+        throw std::invalid_argument("Invalid JSON escape sequence.");
+
+    uint_t value = 0;
+
+    for (const char_t* end = it + 4; it != end; ++it) {
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*it);
+
+        if (unit - '0' < 10)
+            value = value * 16 + unit - '0';
+        else if ((unit | 0x20) - 'a' < 6)
+            value = value * 16 + (unit | 0x20) - 'a' + 10;
+        else
+            throw std::invalid_argument("Invalid JSON escape sequence.");
+    }
+
+    return value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void json_escape_units(const charsrc_t* it, const charsrc_t* last, std::basic_string<chardst_t>& out, json_escape_mode mode)
+{
+    // bulk copy runs of units which don't need escaping, escape the rest code point by code point
+
+    const bool ascii = mode == json_escape_mode::ascii;
+
+    out.reserve(out.size() + (last - it));
+
+    while (it != last) {
+
+        const charsrc_t* run = json_clean_end(it, last, ascii);
+
+        append_units(out, it, run);
+        it = run;
+
+        if (it == last)
+            break;
+
+        // code point truncated by the end of string is escaped as U+FFFD
+
+        const charsrc_t* next = code_point_next(it);
+        const uint_t cp = next > last ? 0xfffd : code_point_read(it);
+
+        json_append_escape(out, cp);
+        it = std::min(next, last);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void json_unescape_units(const charsrc_t* it, const charsrc_t* last, std::basic_string<chardst_t>& out)
+{
+    // bulk copy runs of units up to reverse solidus, decode escape sequences one by one
+
+    const charsrc_t solidus = '\\';
+
+    out.reserve(out.size() + (last - it));
+
+    while (it != last) {
+
+        const charsrc_t* run = unit_search(it, last, &solidus, 1);
+
+        append_units(out, it, run);
+        it = run;
+
+        if (it == last)
+            break;
+
+        if (last - it < 2)
+            throw std::invalid_argument("Invalid JSON escape sequence.");
+
+        const uint_t unit = static_cast<unit_t<charsrc_t>>(it[1]);
+        uint_t cp;
+
+        it += 2;
+
+        switch (unit) {
+
+        case '"': cp = '"'; break;
+        case '\\': cp = '\\'; break;
+        case '/': cp = '/'; break;
+        case 'b': cp = '\b'; break;
+        case 'f': cp = '\f'; break;
+        case 'n': cp = '\n'; break;
+        case 'r': cp = '\r'; break;
+        case 't': cp = '\t'; break;
+
+        case 'u':
+
+            cp = json_hex(it, last);
+            it += 4;
+
+            // high surrogate is joined with following escaped low surrogate
+
+            if ((cp & 0xfc00) == 0xd800) {
+
+                const bool escaped = last - it >= 2 && it[0] == '\\' && it[1] == 'u';
+                const uint_t low = escaped ? json_hex(it + 2, last) : 0;
+
+                if ((low & 0xfc00) == 0xdc00) {
+
+                    cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                    it += 6;
+
+                } else {
+
+                    cp = 0xfffd;
+                }
+
+            } else if ((cp & 0xfc00) == 0xdc00) {
+
+                cp = 0xfffd;
+            }
+
+            break;
+
+        default:
+            throw std::invalid_argument("Invalid JSON escape sequence.");
+        }
+
+        chardst_t units[4];
+        out.append(units, code_point_write(units, cp) - units);
+    }
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename chardst_t, typename type_t>
+inline auto json_escape(const type_t& str, json_escape_mode mode) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    std::basic_string<chardst_t> out;
+    json_escape(str, out, mode);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto json_escape(const type_t& str, std::basic_string<chardst_t>& out, json_escape_mode mode) -> decltype(std::cbegin(str), void())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be escaped.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    impl::json_escape_units(first, last, out, mode);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto json_unescape(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    std::basic_string<chardst_t> out;
+    json_unescape(str, out);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto json_unescape(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), void())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be unescaped.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    impl::json_unescape_units(first, last, out);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_json.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
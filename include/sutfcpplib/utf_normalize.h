@@ -0,0 +1,457 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+#include "utf_unicode_tables.h"
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// result of normalization quick check, maybe means that the string has to be normalized to find
+// out whether it is normalized
+
+enum class quick_check { no, yes, maybe };
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// quick check of NFC form by NFC_QC property and canonical ordering, and full check, which
+// normalizes the spans with quick check result maybe
+
+template<typename type_t>
+auto is_nfc_quick(const type_t& str) noexcept -> decltype(std::cbegin(str), quick_check());
+template<typename type_t>
+auto is_nfc(const type_t& str) -> decltype(std::cbegin(str), bool());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// normalization to NFC form, only the spans around code points flagged by quick check are
+// decomposed and recomposed, the second form returns false and doesn't touch the destination
+// string if the source string is already normalized
+
+template<typename chardst_t, typename type_t>
+auto to_nfc(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+template<typename chardst_t, typename type_t>
+auto normalize_nfc(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), bool());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// normalization properties of code point, see tools/unicode_tables.py
+
+constexpr uint_t normalization_class_mask = 0xff;
+constexpr uint_t normalization_maybe = 0x100;
+constexpr uint_t normalization_no = 0x200;
+
+// Hangul syllables are composed and decomposed algorithmically
+
+constexpr uint_t hangul_first = 0xac00;
+constexpr uint_t hangul_count = 11172;
+constexpr uint_t hangul_l_first = 0x1100;
+constexpr uint_t hangul_v_first = 0x1161;
+constexpr uint_t hangul_t_first = 0x11a7;
+constexpr uint_t hangul_l_count = 19;
+constexpr uint_t hangul_v_count = 21;
+constexpr uint_t hangul_t_count = 28;
+
+constexpr uint_t normalization_of(uint_t cp) noexcept
+{
+    return cp < 0x110000 ? normalization_lookup(cp) : 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* nfc_stable_end(const char_t* it, const char_t* last) noexcept
+{
+    // skip code units of code points below U+0300, which are starters with NFC_QC yes, UTF-8
+    // continuation bytes are skipped together with their lead bytes
+
+    constexpr uint_t bound = sizeof(char_t) == 1 ? 0xcc : 0x300;
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    for (; last - it >= static_cast<int_t>(block); it += block) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        __m128i below;
+
+        if constexpr (sizeof(char_t) == 1)
+            below = _mm_cmpeq_epi8(_mm_subs_epu8(units, _mm_set1_epi8(static_cast<char>(bound - 1))), _mm_setzero_si128());
+        else if constexpr (sizeof(char_t) == 2)
+            below = _mm_cmpeq_epi16(_mm_subs_epu16(units, _mm_set1_epi16(bound - 1)), _mm_setzero_si128());
+        else
+            below = _mm_cmplt_epi32(units, _mm_set1_epi32(bound));
+
+        const std::uint32_t mask = _mm_movemask_epi8(below);
+
+        if (mask != 0xffff)
+            return it + bit_scan(~mask & 0xffff) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it) {
+        if (static_cast<unit_t<char_t>>(*it) >= bound)
+            break;
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* nfc_quick_scan(const char_t* it, const char_t* last, const char_t*& stable, bool stop_at_maybe, quick_check& result) noexcept
+{
+    // returns the first code point which fails quick check, stable is set to the last starter
+    // before it which doesn't combine with preceding code points
+
+    uint_t last_class = 0;
+
+    while (true) {
+
+        const char_t* skipped = nfc_stable_end(it, last);
+
+        if (skipped != it) {
+
+            stable = skipped - 1;
+
+            if (sizeof(char_t) == 1 && (static_cast<unit_t<char_t>>(*stable) & 0xc0) == 0x80)
+                --stable;
+
+            last_class = 0;
+            it = skipped;
+        }
+
+        if (it == last)
+            return last;
+
+        // code point truncated by the end of string fails the check
+
+        const char_t* next = code_point_next(it);
+
+        if (next > last) {
+
+            result = quick_check::no;
+            return it;
+        }
+
+        const uint_t properties = normalization_of(code_point_read(it));
+        const uint_t current_class = properties & normalization_class_mask;
+
+        if ((properties & normalization_no) != 0 || (current_class != 0 && current_class < last_class)) {
+
+            result = quick_check::no;
+            return it;
+        }
+
+        if ((properties & normalization_maybe) != 0) {
+
+            result = quick_check::maybe;
+
+            if (stop_at_maybe)
+                return it;
+        }
+
+        if (properties == 0)
+            stable = it;
+
+        last_class = current_class;
+        it = next;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void nfc_decompose(uint_t cp, std::u32string& span)
+{
+    if (cp - hangul_first < hangul_count) {
+
+        const uint_t index = cp - hangul_first;
+
+        span.push_back(static_cast<char32_t>(hangul_l_first + index / (hangul_v_count * hangul_t_count)));
+        span.push_back(static_cast<char32_t>(hangul_v_first + index % (hangul_v_count * hangul_t_count) / hangul_t_count));
+
+        if (index % hangul_t_count != 0)
+            span.push_back(static_cast<char32_t>(hangul_t_first + index % hangul_t_count));
+
+    } else if (const uint_t value = cp < 0x110000 ? decomposition_lookup(cp) : 0; value != 0) {
+
+        const auto* units = decomposition_units + (value >> 3);
+        span.append(units, units + (value & 7));
+
+    } else {
+
+        span.push_back(static_cast<char32_t>(cp));
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t nfc_compose(uint_t first, uint_t second) noexcept
+{
+    // primary composite of two code points or zero
+
+    if (first - hangul_l_first < hangul_l_count && second - hangul_v_first < hangul_v_count)
+        return hangul_first + ((first - hangul_l_first) * hangul_v_count + second - hangul_v_first) * hangul_t_count;
+
+    if (first - hangul_first < hangul_count && (first - hangul_first) % hangul_t_count == 0 && second - hangul_t_first - 1 < hangul_t_count - 1)
+        return first + second - hangul_t_first;
+
+    const std::uint64_t key = std::uint64_t(first) << 42 | std::uint64_t(second) << 21;
+    const auto found = std::lower_bound(std::begin(composition_pairs), std::end(composition_pairs), key);
+
+    if (found != std::end(composition_pairs) && (*found >> 21) == (key >> 21))
+        return static_cast<uint_t>(*found & 0x1fffff);
+
+    return 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void nfc_normalize_span(const char_t* it, const char_t* last, std::u32string& span)
+{
+    // full canonical decomposition
+
+    span.clear();
+
+    while (it != last) {
+
+        const char_t* next = code_point_next(it);
+
+        nfc_decompose(next > last ? 0xfffd : code_point_read(it), span);
+        it = std::min(next, last);
+    }
+
+    // canonical ordering of non-starters
+
+    for (uint_t index = 1; index < span.size(); ++index) {
+
+        const uint_t current_class = normalization_of(span[index]) & normalization_class_mask;
+
+        for (uint_t pos = index; current_class != 0 && pos != 0 && (normalization_of(span[pos - 1]) & normalization_class_mask) > current_class; --pos)
+            std::swap(span[pos], span[pos - 1]);
+    }
+
+    // canonical composition, code point combines with the last starter unless a code point with
+    // the same or zero combining class stands between them
+
+    uint_t size = 0;
+    uint_t starter = npos;
+    int last_class = -1;
+
+    for (uint_t index = 0; index != span.size(); ++index) {
+
+        const uint_t cp = span[index];
+        const int current_class = static_cast<int>(normalization_of(cp) & normalization_class_mask);
+
+        if (starter != npos && last_class < current_class) {
+
+            if (const uint_t composite = nfc_compose(span[starter], cp); composite != 0) {
+
+                span[starter] = static_cast<char32_t>(composite);
+                continue;
+            }
+        }
+
+        span[size++] = static_cast<char32_t>(cp);
+
+        if (current_class == 0) {
+
+            starter = size - 1;
+            last_class = -1;
+
+        } else {
+
+            last_class = current_class;
+        }
+    }
+
+    span.resize(size);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void nfc_normalize_units(const charsrc_t* it, const charsrc_t* last, const charsrc_t* stable, const charsrc_t* flagged, std::basic_string<chardst_t>& out)
+{
+    // copy the code units up to stable code point before flagged one, normalize the span up to
+    // the next stable code point and continue quick check after it
+
+    std::u32string span;
+
+    while (flagged != last) {
+
+        append_units(out, it, stable);
+
+        const charsrc_t* end = std::min(code_point_next(flagged), last);
+
+        while (end != last) {
+
+            const charsrc_t* next = code_point_next(end);
+
+            if (next > last) {
+
+                end = last;
+                break;
+            }
+
+            if (normalization_of(code_point_read(end)) == 0)
+                break;
+
+            end = next;
+        }
+
+        nfc_normalize_span(stable, end, span);
+
+        for (const char32_t cp : span) {
+
+            chardst_t units[4];
+            out.append(units, code_point_write(units, cp) - units);
+        }
+
+        quick_check result = quick_check::yes;
+
+        it = stable = end;
+        flagged = nfc_quick_scan(it, last, stable, true, result);
+    }
+
+    append_units(out, it, last);
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+inline auto is_nfc_quick(const type_t& str) noexcept -> decltype(std::cbegin(str), quick_check())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be checked.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    auto stable = first;
+    quick_check result = quick_check::yes;
+
+    impl::nfc_quick_scan(first, last, stable, false, result);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto is_nfc(const type_t& str) -> decltype(std::cbegin(str), bool())
+{
+    const quick_check result = is_nfc_quick(str);
+
+    if (result != quick_check::maybe)
+        return result == quick_check::yes;
+
+    const auto [first, last] = impl::code_units_of(str);
+    std::basic_string<std::remove_cv_t<std::remove_pointer_t<decltype(first)>>> normalized;
+
+    return !normalize_nfc(str, normalized) || equal(std::basic_string_view(first, last - first), normalized);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto to_nfc(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    std::basic_string<chardst_t> out;
+
+    if (!normalize_nfc(str, out)) {
+
+        const auto [first, last] = impl::code_units_of(str);
+        impl::append_units(out, first, last);
+    }
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto normalize_nfc(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), bool())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be normalized.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    auto stable = first;
+    quick_check result = quick_check::yes;
+    const auto flagged = impl::nfc_quick_scan(first, last, stable, true, result);
+
+    if (flagged == last)
+        return false;
+
+    out.clear();
+    out.reserve(last - first);
+    impl::nfc_normalize_units(first, last, stable, flagged, out);
+
+    return true;
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_normalize.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
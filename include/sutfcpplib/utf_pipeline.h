@@ -0,0 +1,480 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_stream.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// transcoding pipeline settings, source is split into blocks which are read, converted and written
+// by concurrent stages, the number of blocks in flight is the number of buffers, but not less than
+// the number of converter workers plus two
+
+struct pipeline_options
+{
+    uint_t block_size = 1 << 20; // source code units per block
+    uint_t buffers = 3;
+    uint_t workers = 1;
+};
+
+// amount of data passed through pipeline stage and time the stage was busy, time of converter
+// stage is summed over all workers
+
+struct pipeline_stage
+{
+    uint_t bytes = 0;
+    double seconds = 0;
+
+    double throughput() const noexcept;
+};
+
+struct pipeline_statistics
+{
+    pipeline_stage read;
+    pipeline_stage convert;
+    pipeline_stage write;
+    double seconds = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// transcode data supplied by reader to writer, reader is called as uint_t(charsrc_t* buffer,
+// uint_t size) and returns the number of units read or zero at the end, writer is called as
+// void(const chardst_t* buffer, uint_t size), exceptions thrown by reader or writer stop
+// the pipeline and are rethrown
+
+template<typename charsrc_t, typename chardst_t, typename reader_t, typename writer_t>
+pipeline_statistics transcode_pipeline(reader_t&& reader, writer_t&& writer, const pipeline_options& options = {});
+
+template<typename charsrc_t, typename chardst_t>
+pipeline_statistics transcode_stream(std::basic_streambuf<charsrc_t>& src, std::basic_streambuf<chardst_t>& dst, const pipeline_options& options = {});
+
+// transcode file of code units in native byte order
+
+template<typename charsrc_t, typename chardst_t>
+pipeline_statistics transcode_file(const std::string& src_path, const std::string& dst_path, const pipeline_options& options = {});
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+class pipeline_engine
+{
+    // blocks cycle through states free -> reading -> read -> converting -> converted -> free,
+    // reader and writer handle blocks in sequence order, converters take any read block,
+    // code point split by block boundary is carried over by reader to the next block
+
+    using clock = std::chrono::steady_clock;
+
+    enum class state { free, reading, read, converting, converted };
+
+    struct block
+    {
+        std::vector<charsrc_t> input;
+        std::vector<chardst_t> output;
+        uint_t input_size = 0;
+        uint_t output_size = 0;
+        uint_t sequence = 0;
+        state status = state::free;
+    };
+
+public:
+    explicit pipeline_engine(const pipeline_options& options)
+        : m_block_size(std::max<uint_t>(options.block_size, 4))
+        , m_blocks(std::max<uint_t>(options.buffers, std::max<uint_t>(options.workers, 1) + 2))
+        , m_workers(std::max<uint_t>(options.workers, 1))
+    {
+        for (block& item : m_blocks) {
+
+            item.input.resize(m_block_size + 3);
+            item.output.resize(max_code_units<chardst_t, charsrc_t>(m_block_size + 3));
+        }
+    }
+
+    template<typename reader_t, typename writer_t>
+    pipeline_statistics run(reader_t& reader, writer_t& writer)
+    {
+        const clock::time_point start = clock::now();
+
+        std::thread read_thread([&] { guard([&] { read_stage(reader); }); });
+        std::vector<std::thread> convert_threads;
+
+        try {
+
+            convert_threads.reserve(m_workers);
+
+            for (uint_t index = 0; index != m_workers; ++index)
+                convert_threads.emplace_back([&] { guard([&] { convert_stage(); }); });
+
+        } catch (...) {
+
+            // started stages are aborted and joined before the error is reported
+
+            {
+                const std::lock_guard lock(m_mutex);
+
+                m_abort = true;
+                m_changed.notify_all();
+            }
+
+            read_thread.join();
+
+            for (std::thread& thread : convert_threads)
+                thread.join();
+
+            throw;
+        }
+
+        guard([&] { write_stage(writer); });
+
+        read_thread.join();
+
+        for (std::thread& thread : convert_threads)
+            thread.join();
+
+        if (m_error)
+            std::rethrow_exception(m_error);
+
+        m_statistics.seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+        return m_statistics;
+    }
+
+private:
+    template<typename func_t>
+    void guard(func_t func) noexcept
+    {
+        // the first exception aborts all stages
+
+        try {
+
+            func();
+
+        } catch (...) {
+
+            const std::lock_guard lock(m_mutex);
+
+            if (!m_error)
+                m_error = std::current_exception();
+
+            m_abort = true;
+            m_changed.notify_all();
+        }
+    }
+
+    template<typename pred_t, typename done_t>
+    block* acquire(std::unique_lock<std::mutex>& lock, pred_t pred, done_t done)
+    {
+        // wait for block matching predicate, returns nullptr if pipeline is aborted or the stage
+        // is done
+
+        block* found = nullptr;
+
+        m_changed.wait(lock, [&] {
+
+            for (block& item : m_blocks) {
+
+                if (pred(item)) {
+
+                    found = &item;
+                    return true;
+                }
+            }
+
+            return m_abort || done();
+        });
+
+        return m_abort ? nullptr : found;
+    }
+
+    template<typename reader_t>
+    void read_stage(reader_t& reader)
+    {
+        charsrc_t carry[3];
+        uint_t carry_size = 0;
+
+        for (;;) {
+
+            std::unique_lock lock(m_mutex);
+            block* item = acquire(lock, [](const block& item) { return item.status == state::free; }, [] { return false; });
+
+            if (!item)
+                return;
+
+            item->status = state::reading;
+            lock.unlock();
+
+            std::copy(carry, carry + carry_size, item->input.data());
+
+            const clock::time_point start = clock::now();
+            const uint_t count = reader(item->input.data() + carry_size, m_block_size);
+            const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+            // incomplete code point at the end of source is converted as is
+
+            const charsrc_t* first = item->input.data();
+            const charsrc_t* last = first + carry_size + count;
+            const charsrc_t* end = count == 0 ? last : complete_end(first, last);
+
+            carry_size = last - end;
+            std::copy(end, last, carry);
+            item->input_size = end - first;
+
+            lock.lock();
+
+            m_statistics.read.bytes += count * sizeof(charsrc_t);
+            m_statistics.read.seconds += seconds;
+
+            if (first == last) {
+
+                item->status = state::free;
+                m_read_done = true;
+                m_changed.notify_all();
+
+                return;
+            }
+
+            item->sequence = m_read_count++;
+            item->status = state::read;
+            m_changed.notify_all();
+        }
+    }
+
+    void convert_stage()
+    {
+        for (;;) {
+
+            std::unique_lock lock(m_mutex);
+            block* item = acquire(lock, [](const block& item) { return item.status == state::read; }, [this] { return m_read_done && m_converted == m_read_count; });
+
+            if (!item)
+                return;
+
+            item->status = state::converting;
+            lock.unlock();
+
+            const clock::time_point start = clock::now();
+            const charsrc_t* first = item->input.data();
+            item->output_size = transcode(first, first + item->input_size, item->output.data()) - item->output.data();
+            const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+            lock.lock();
+
+            m_statistics.convert.bytes += item->input_size * sizeof(charsrc_t);
+            m_statistics.convert.seconds += seconds;
+
+            ++m_converted;
+            item->status = state::converted;
+            m_changed.notify_all();
+        }
+    }
+
+    template<typename writer_t>
+    void write_stage(writer_t& writer)
+    {
+        for (;;) {
+
+            std::unique_lock lock(m_mutex);
+            block* item = acquire(lock, [this](const block& item) { return item.status == state::converted && item.sequence == m_written; }, [this] { return m_read_done && m_written == m_read_count; });
+
+            if (!item)
+                return;
+
+            lock.unlock();
+
+            const clock::time_point start = clock::now();
+            writer(static_cast<const chardst_t*>(item->output.data()), item->output_size);
+            const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+            lock.lock();
+
+            m_statistics.write.bytes += item->output_size * sizeof(chardst_t);
+            m_statistics.write.seconds += seconds;
+
+            ++m_written;
+            item->status = state::free;
+            m_changed.notify_all();
+        }
+    }
+
+private:
+    const uint_t m_block_size;
+    std::vector<block> m_blocks;
+    const uint_t m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    uint_t m_read_count = 0;
+    uint_t m_converted = 0;
+    uint_t m_written = 0;
+    bool m_read_done = false;
+    bool m_abort = false;
+    std::exception_ptr m_error;
+    pipeline_statistics m_statistics;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct file_closer
+{
+    void operator()(std::FILE* file) const noexcept
+    {
+        std::fclose(file);
+    }
+};
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// pipeline_stage
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline double pipeline_stage::throughput() const noexcept
+{
+    // bytes per second
+
+    return seconds > 0 ? bytes / seconds : 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename charsrc_t, typename chardst_t, typename reader_t, typename writer_t>
+inline pipeline_statistics transcode_pipeline(reader_t&& reader, writer_t&& writer, const pipeline_options& options)
+{
+    static_assert(is_any_char_v<charsrc_t> && is_any_char_v<chardst_t>);
+
+    return impl::pipeline_engine<charsrc_t, chardst_t>(options).run(reader, writer);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline pipeline_statistics transcode_stream(std::basic_streambuf<charsrc_t>& src, std::basic_streambuf<chardst_t>& dst, const pipeline_options& options)
+{
+    const auto reader = [&src](charsrc_t* buffer, uint_t size) {
+        return static_cast<uint_t>(std::max<std::streamsize>(src.sgetn(buffer, size), 0));
+    };
+
+    const auto writer = [&dst](const chardst_t* buffer, uint_t size) {
+        if (dst.sputn(buffer, size) != static_cast<std::streamsize>(size))
+            throw std::runtime_error("Failed to write transcoded data.");
+    };
+
+    pipeline_statistics result = transcode_pipeline<charsrc_t, chardst_t>(reader, writer, options);
+
+    if (dst.pubsync() == -1)
+        throw std::runtime_error("Failed to write transcoded data.");
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline pipeline_statistics transcode_file(const std::string& src_path, const std::string& dst_path, const pipeline_options& options)
+{
+    const std::unique_ptr<std::FILE, impl::file_closer> src(std::fopen(src_path.c_str(), "rb"));
+
+    if (!src)
+        throw std::runtime_error("Failed to open source file.");
+
+    std::unique_ptr<std::FILE, impl::file_closer> dst(std::fopen(dst_path.c_str(), "wb"));
+
+    if (!dst)
+        throw std::runtime_error("Failed to create destination file.");
+
+    // pipeline buffers replace stdio ones
+
+    std::setvbuf(src.get(), nullptr, _IONBF, 0);
+    std::setvbuf(dst.get(), nullptr, _IONBF, 0);
+
+    const auto reader = [&src](charsrc_t* buffer, uint_t size) {
+
+        const uint_t count = std::fread(buffer, sizeof(charsrc_t), size, src.get());
+
+        if (count != size && std::ferror(src.get()))
+            throw std::runtime_error("Failed to read source file.");
+
+        return count;
+    };
+
+    const auto writer = [&dst](const chardst_t* buffer, uint_t size) {
+        if (std::fwrite(buffer, sizeof(chardst_t), size, dst.get()) != size)
+            throw std::runtime_error("Failed to write destination file.");
+    };
+
+    pipeline_statistics result = transcode_pipeline<charsrc_t, chardst_t>(reader, writer, options);
+
+    if (std::fclose(dst.release()) != 0)
+        throw std::runtime_error("Failed to write destination file.");
+
+    return result;
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_pipeline.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,335 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+#include "utf_unicode_tables.h"
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// general category of code point, unassigned code points and values out of Unicode range are
+// reported as unassigned
+
+enum class general_category : std::uint8_t
+{
+    unassigned,
+    uppercase_letter,
+    lowercase_letter,
+    titlecase_letter,
+    modifier_letter,
+    other_letter,
+    nonspacing_mark,
+    spacing_mark,
+    enclosing_mark,
+    decimal_number,
+    letter_number,
+    other_number,
+    connector_punctuation,
+    dash_punctuation,
+    open_punctuation,
+    close_punctuation,
+    initial_punctuation,
+    final_punctuation,
+    other_punctuation,
+    math_symbol,
+    currency_symbol,
+    modifier_symbol,
+    other_symbol,
+    space_separator,
+    line_separator,
+    paragraph_separator,
+    control,
+    format,
+    surrogate,
+    private_use,
+};
+
+// properties which can be classified in batch, whitespace is White_Space property, letter is any
+// of L* categories, digit is Nd category
+
+enum class code_point_property { whitespace, letter, digit };
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// properties of single code point, lookup in generated three stage tables
+
+constexpr general_category code_point_category(uint_t cp) noexcept;
+constexpr bool is_whitespace(uint_t cp) noexcept;
+constexpr bool is_letter(uint_t cp) noexcept;
+constexpr bool is_digit(uint_t cp) noexcept;
+constexpr bool has_property(uint_t cp, code_point_property property) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// classify every code point of contiguous string, bit i of bitmap is set if code point i has the
+// property, bitmap must have space for (code point count + 63) / 64 words, returns code point count
+
+template<typename type_t>
+auto classify(const type_t& str, code_point_property property, std::uint64_t* bitmap) -> decltype(std::cbegin(str), uint_t());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// packed properties of code point, see tools/unicode_tables.py
+
+constexpr std::uint8_t property_category_mask = 0x1f;
+constexpr std::uint8_t property_white_space = 0x20;
+
+constexpr std::uint8_t property_of(uint_t cp) noexcept
+{
+    return cp < 0x110000 ? property_lookup(cp) : 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class bitmap_writer
+{
+    // appends bits to bitmap word by word, the last partial word is stored by finish
+
+public:
+    explicit bitmap_writer(std::uint64_t* bitmap) noexcept
+        : m_bitmap(bitmap)
+    {
+    }
+
+    void append(std::uint64_t bits, uint_t count) noexcept
+    {
+        const uint_t offset = m_count & 63;
+
+        m_word |= bits << offset;
+
+        if (offset + count >= 64) {
+
+            m_bitmap[m_count >> 6] = m_word;
+            m_word = offset != 0 ? bits >> (64 - offset) : 0;
+        }
+
+        m_count += count;
+    }
+
+    uint_t finish() noexcept
+    {
+        if ((m_count & 63) != 0)
+            m_bitmap[m_count >> 6] = m_word;
+
+        return m_count;
+    }
+
+private:
+    std::uint64_t* m_bitmap;
+    std::uint64_t m_word = 0;
+    uint_t m_count = 0;
+};
+
+
+
+#if defined(SUTF_SIMD_SSE2)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline std::uint32_t ascii_property_mask(__m128i units, code_point_property property) noexcept
+{
+    // property mask of 16 ASCII bytes, ranges are tested by unsigned minimum of shifted value
+
+    const auto in_range = [](__m128i value, char first, char size) {
+
+        const __m128i shifted = _mm_sub_epi8(value, _mm_set1_epi8(first));
+        return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(size - 1)), shifted);
+    };
+
+    __m128i mask;
+
+    switch (property) {
+
+    case code_point_property::whitespace:
+        mask = _mm_or_si128(_mm_cmpeq_epi8(units, _mm_set1_epi8(' ')), in_range(units, '\t', 5));
+        break;
+
+    case code_point_property::letter:
+        mask = in_range(_mm_or_si128(units, _mm_set1_epi8(0x20)), 'a', 26);
+        break;
+
+    default:
+        mask = in_range(units, '0', 10);
+    }
+
+    return _mm_movemask_epi8(mask);
+}
+#endif // SUTF_SIMD_SSE2
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t classify_units(const char_t* it, const char_t* last, code_point_property property, std::uint64_t* bitmap) noexcept
+{
+    // blocks of 16 ASCII units are classified by SIMD, the rest code point by code point
+
+    bitmap_writer writer(bitmap);
+
+    while (it != last) {
+
+#if defined(SUTF_SIMD_SSE2)
+        if constexpr (sizeof(char_t) <= 2) {
+
+            if (last - it >= 16) {
+
+                __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+                bool ascii;
+
+                // UTF-16 units are packed to bytes after ASCII check, as packing saturates signed
+
+                if constexpr (sizeof(char_t) == 2) {
+
+                    const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 8));
+                    const __m128i any = _mm_and_si128(_mm_or_si128(units, high), _mm_set1_epi16(static_cast<short>(0xff80)));
+
+                    ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(any, _mm_setzero_si128())) == 0xffff;
+                    units = _mm_packus_epi16(units, high);
+
+                } else {
+
+                    ascii = _mm_movemask_epi8(units) == 0;
+                }
+
+                if (ascii) {
+
+                    writer.append(ascii_property_mask(units, property), 16);
+                    it += 16;
+                    continue;
+                }
+            }
+        }
+#endif // SUTF_SIMD_SSE2
+
+        // code point truncated by the end of string has no properties
+
+        const char_t* next = code_point_next(it);
+        const uint_t cp = next > last ? 0xfffd : code_point_read(it);
+
+        writer.append(has_property(cp, property), 1);
+        it = std::min(next, last);
+    }
+
+    return writer.finish();
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr general_category code_point_category(uint_t cp) noexcept
+{
+    return static_cast<general_category>(impl::property_of(cp) & impl::property_category_mask);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool is_whitespace(uint_t cp) noexcept
+{
+    return (impl::property_of(cp) & impl::property_white_space) != 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool is_letter(uint_t cp) noexcept
+{
+    const general_category category = code_point_category(cp);
+
+    return category >= general_category::uppercase_letter && category <= general_category::other_letter;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool is_digit(uint_t cp) noexcept
+{
+    return code_point_category(cp) == general_category::decimal_number;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool has_property(uint_t cp, code_point_property property) noexcept
+{
+    switch (property) {
+
+    case code_point_property::whitespace:
+        return is_whitespace(cp);
+
+    case code_point_property::letter:
+        return is_letter(cp);
+
+    default:
+        return is_digit(cp);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline auto classify(const type_t& str, code_point_property property, std::uint64_t* bitmap) -> decltype(std::cbegin(str), uint_t())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be classified.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    return impl::classify_units(first, last, property, bitmap);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_property.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
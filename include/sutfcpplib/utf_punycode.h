@@ -0,0 +1,501 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+
+#include <stdexcept>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Punycode (RFC 3492) of contiguous string in any encoding, code points are read from the source
+// string directly, the second forms append to the destination string, malformed Punycode throws
+// std::invalid_argument
+
+template<typename chardst_t, typename type_t>
+auto punycode_encode(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+template<typename chardst_t, typename type_t>
+auto punycode_encode(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), void());
+
+template<typename chardst_t, typename type_t>
+auto punycode_decode(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+template<typename chardst_t, typename type_t>
+auto punycode_decode(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), void());
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// convert labels of domain name between Unicode and ASCII forms, labels with non-ASCII code points
+// are encoded with xn-- prefix, label separators are full stops and ideographic full stops, IDNA
+// mapping and validation of labels are not performed
+
+template<typename chardst_t, typename type_t>
+auto domain_to_ascii(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+template<typename chardst_t, typename type_t>
+auto domain_to_unicode(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Punycode parameters
+
+inline constexpr uint_t punycode_base = 36;
+inline constexpr uint_t punycode_tmin = 1;
+inline constexpr uint_t punycode_tmax = 26;
+inline constexpr uint_t punycode_skew = 38;
+inline constexpr uint_t punycode_damp = 700;
+inline constexpr uint_t punycode_initial_bias = 72;
+inline constexpr uint_t punycode_initial_n = 0x80;
+inline constexpr uint_t punycode_max = 0xffffffff;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t punycode_read(const char_t*& it, const char_t* last) noexcept
+{
+    // code point truncated by the end of string is read as U+FFFD
+
+    const char_t* next = code_point_next(it);
+    const uint_t cp = next > last ? 0xfffd : code_point_read(it);
+
+    it = std::min(next, last);
+
+    return cp;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t punycode_threshold(uint_t k, uint_t bias) noexcept
+{
+    return k <= bias ? punycode_tmin : k >= bias + punycode_tmax ? punycode_tmax : k - bias;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t punycode_adapt(uint_t delta, uint_t count, bool first) noexcept
+{
+    delta = first ? delta / punycode_damp : delta / 2;
+    delta += delta / count;
+
+    uint_t k = 0;
+
+    for (; delta > ((punycode_base - punycode_tmin) * punycode_tmax) / 2; k += punycode_base)
+        delta /= punycode_base - punycode_tmin;
+
+    return k + (punycode_base - punycode_tmin + 1) * delta / (delta + punycode_skew);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t punycode_value(uint_t unit) noexcept
+{
+    // digit value of basic code point, the base for non digits
+
+    if (unit - '0' < 10)
+        return unit - '0' + 26;
+
+    if ((unit | 0x20) - 'a' < 26)
+        return (unit | 0x20) - 'a';
+
+    return punycode_base;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t>
+inline void punycode_append_number(std::basic_string<chardst_t>& out, uint_t q, uint_t bias)
+{
+    // generalized variable length integer with lowercase digits
+
+    for (uint_t k = punycode_base;; k += punycode_base) {
+
+        const uint_t t = punycode_threshold(k, bias);
+
+        if (q < t)
+            break;
+
+        const uint_t digit = t + (q - t) % (punycode_base - t);
+
+        out.push_back(static_cast<chardst_t>(digit < 26 ? 'a' + digit : '0' + digit - 26));
+        q = (q - t) / (punycode_base - t);
+    }
+
+    out.push_back(static_cast<chardst_t>(q < 26 ? 'a' + q : '0' + q - 26));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void punycode_encode_units(const charsrc_t* first, const charsrc_t* last, std::basic_string<chardst_t>& out)
+{
+    // the source is scanned once per distinct non-basic code point, every scan inserts code points
+    // equal to n and finds the next smallest one
+
+    uint_t total = 0;
+    uint_t basic = 0;
+    uint_t m = punycode_max;
+
+    for (const charsrc_t* it = first; it != last; ++total) {
+
+        const uint_t cp = punycode_read(it, last);
+
+        if (cp < punycode_initial_n) {
+
+            out.push_back(static_cast<chardst_t>(cp));
+            ++basic;
+
+        } else {
+
+            m = std::min(m, cp);
+        }
+    }
+
+    if (basic != 0)
+        out.push_back(static_cast<chardst_t>('-'));
+
+    uint_t n = punycode_initial_n;
+    uint_t delta = 0;
+    uint_t bias = punycode_initial_bias;
+    uint_t handled = basic;
+
+    while (handled != total) {
+
+        if ((m - n) > (punycode_max - delta) / (handled + 1))
+            throw std::invalid_argument("Punycode overflow.");
+
+        delta += (m - n) * (handled + 1);
+        n = m;
+        m = punycode_max;
+
+        for (const charsrc_t* it = first; it != last;) {
+
+            const uint_t cp = punycode_read(it, last);
+
+            if (cp < n) {
+
+                if (++delta == 0)
+                    throw std::invalid_argument("Punycode overflow.");
+
+            } else if (cp == n) {
+
+                punycode_append_number(out, delta, bias);
+                bias = punycode_adapt(delta, handled + 1, handled == basic);
+                delta = 0;
+                ++handled;
+
+            } else {
+
+                m = std::min(m, cp);
+            }
+        }
+
+        ++delta;
+        ++n;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename charsrc_t>
+inline void punycode_decode_units(const charsrc_t* first, const charsrc_t* last, std::basic_string<chardst_t>& out)
+{
+    // code points are inserted into the destination string, their positions are found by
+    // skipping code points from the start of the decoded part
+
+    const uint_t start = out.size();
+    const charsrc_t* delimiter = last;
+
+    while (delimiter != first && *(delimiter - 1) != '-')
+        --delimiter;
+
+    const charsrc_t* it = first;
+    uint_t count = 0;
+
+    if (delimiter != first) {
+
+        for (; it != delimiter - 1; ++it, ++count) {
+
+            if (static_cast<uint_t>(*it) >= punycode_initial_n)
+                throw std::invalid_argument("Invalid Punycode string.");
+
+            out.push_back(static_cast<chardst_t>(*it));
+        }
+
+        ++it;
+    }
+
+    uint_t n = punycode_initial_n;
+    uint_t i = 0;
+    uint_t bias = punycode_initial_bias;
+
+    while (it != last) {
+
+        const uint_t old_i = i;
+        uint_t w = 1;
+
+        for (uint_t k = punycode_base;; k += punycode_base) {
+
+            if (it == last)
+                throw std::invalid_argument("Invalid Punycode string.");
+
+            const uint_t digit = punycode_value(static_cast<unit_t<charsrc_t>>(*it++));
+
+            if (digit >= punycode_base)
+                throw std::invalid_argument("Invalid Punycode string.");
+
+            if (digit > (punycode_max - i) / w)
+                throw std::invalid_argument("Punycode overflow.");
+
+            i += digit * w;
+
+            const uint_t t = punycode_threshold(k, bias);
+
+            if (digit < t)
+                break;
+
+            if (w > punycode_max / (punycode_base - t))
+                throw std::invalid_argument("Punycode overflow.");
+
+            w *= punycode_base - t;
+        }
+
+        bias = punycode_adapt(i - old_i, count + 1, old_i == 0);
+        n += i / (count + 1);
+        i %= count + 1;
+
+        if (n < punycode_initial_n || n > 0x10ffff || (n & 0xfffff800) == 0xd800)
+            throw std::invalid_argument("Invalid Punycode string.");
+
+        chardst_t units[4];
+        const uint_t size = code_point_write(units, n) - units;
+        const uint_t offset = code_point_skip(out.data() + start, out.data() + out.size(), i) - out.data();
+
+        out.resize(out.size() + size);
+        std::copy_backward(out.begin() + offset, out.end() - size, out.end());
+        std::copy(units, units + size, out.begin() + offset);
+        ++i;
+        ++count;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool is_label_separator(uint_t cp) noexcept
+{
+    return cp == '.' || cp == 0x3002 || cp == 0xff0e || cp == 0xff61;
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename chardst_t, typename type_t>
+inline auto punycode_encode(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    std::basic_string<chardst_t> out;
+    punycode_encode(str, out);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto punycode_encode(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), void())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be encoded.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    impl::punycode_encode_units(first, last, out);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto punycode_decode(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    std::basic_string<chardst_t> out;
+    punycode_decode(str, out);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto punycode_decode(const type_t& str, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(str), void())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be decoded.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    impl::punycode_decode_units(first, last, out);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto domain_to_ascii(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be converted.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    std::basic_string<chardst_t> out;
+
+    // ASCII names are copied as is
+
+    if (impl::ascii_end(first, last) == last) {
+
+        impl::append_units(out, first, last);
+        return out;
+    }
+
+    for (auto it = first; it != last;) {
+
+        // find the end of label, ASCII labels are copied, the other ones are encoded
+
+        auto label_last = it;
+        auto next = it;
+        bool ascii = true;
+
+        while (next != last) {
+
+            const auto cp_first = next;
+            const uint_t cp = impl::punycode_read(next, last);
+
+            if (impl::is_label_separator(cp)) {
+
+                label_last = cp_first;
+                break;
+            }
+
+            ascii = ascii && cp < 0x80;
+            label_last = next;
+        }
+
+        if (ascii) {
+
+            impl::append_units(out, it, label_last);
+
+        } else {
+
+            out.append({ static_cast<chardst_t>('x'), static_cast<chardst_t>('n'), static_cast<chardst_t>('-'), static_cast<chardst_t>('-') });
+            impl::punycode_encode_units(it, label_last, out);
+        }
+
+        if (label_last != next)
+            out.push_back(static_cast<chardst_t>('.'));
+
+        it = next;
+    }
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto domain_to_unicode(const type_t& str) -> decltype(std::cbegin(str), std::basic_string<chardst_t>())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be converted.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    std::basic_string<chardst_t> out;
+
+    for (auto it = first; it != last;) {
+
+        // labels with case insensitive xn-- prefix are decoded, the other ones are copied
+
+        auto label_last = it;
+        auto next = it;
+
+        while (next != last) {
+
+            const auto cp_first = next;
+
+            if (impl::is_label_separator(impl::punycode_read(next, last))) {
+
+                label_last = cp_first;
+                break;
+            }
+
+            label_last = next;
+        }
+
+        if (label_last - it >= 4 && (it[0] | 0x20) == 'x' && (it[1] | 0x20) == 'n' && it[2] == '-' && it[3] == '-')
+            impl::punycode_decode_units(it + 4, label_last, out);
+        else
+            impl::append_units(out, it, label_last);
+
+        if (label_last != next)
+            out.push_back(static_cast<chardst_t>('.'));
+
+        it = next;
+    }
+
+    return out;
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_punycode.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,834 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_string.h"
+#include "utf_simd.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// rope_metrics
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// lengths of text fragment in code points and in code units of every encoding
+
+struct rope_metrics
+{
+    uint_t code_points = 0;
+    uint_t utf8_units = 0;
+    uint_t utf16_units = 0;
+
+    template<typename char_t>
+    constexpr uint_t code_units() const noexcept;
+
+    constexpr rope_metrics& operator+=(const rope_metrics& other) noexcept;
+    constexpr rope_metrics& operator-=(const rope_metrics& other) noexcept;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// rope
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// text container for large edited documents, the text is split into chunks kept in the leaves of
+// B-tree and every node caches metrics of its subtree, so that editing and position conversion
+// take logarithmic time
+
+template<typename char_t = char>
+class rope
+{
+    static_assert(is_any_char_v<char_t>);
+
+public:
+    using value_type = char_t;
+
+    static constexpr uint_t max_leaf_size = 1024;
+    static constexpr uint_t min_leaf_size = max_leaf_size / 4;
+    static constexpr uint_t max_node_size = 16;
+    static constexpr uint_t min_node_size = max_node_size / 4;
+
+public:
+    rope();
+    explicit rope(const std::basic_string_view<char_t>& str);
+    rope(const rope& other);
+    rope(rope&& other) noexcept = default;
+
+    rope& operator=(const rope& other);
+    rope& operator=(rope&& other) noexcept = default;
+
+    uint_t size() const noexcept;
+    uint_t length() const noexcept;
+    bool empty() const noexcept;
+    const rope_metrics& metrics() const noexcept;
+
+    void insert(uint_t pos, const std::basic_string_view<char_t>& str);
+    template<typename charsrc_t>
+    void insert(uint_t pos, const std::basic_string_view<charsrc_t>& str);
+    void append(const std::basic_string_view<char_t>& str);
+    void erase(uint_t pos, uint_t count);
+    void clear();
+
+    template<typename charunit_t>
+    uint_t code_unit_offset(uint_t pos) const;
+    template<typename charunit_t>
+    uint_t code_point_offset(uint_t offset) const;
+
+    std::basic_string<char_t> substr(uint_t pos, uint_t count) const;
+    std::basic_string<char_t> str() const;
+    template<typename func_t>
+    void for_each_chunk(func_t&& func) const;
+
+private:
+    struct node;
+    using node_ptr = std::unique_ptr<node>;
+    using node_list = std::vector<node_ptr>;
+
+    struct node
+    {
+        rope_metrics metrics;
+        bool leaf = true;
+        std::basic_string<char_t> text;
+        node_list children;
+    };
+
+    const node& root() const noexcept;
+
+    static rope_metrics measure(const char_t* it, const char_t* last) noexcept;
+    static uint_t leaf_offset(const std::basic_string<char_t>& text, uint_t offset, uint_t pos) noexcept;
+    static node_ptr make_leaf(const char_t* it, const char_t* last);
+    static node_ptr make_inner(typename node_list::iterator it, typename node_list::iterator last);
+    static node_ptr clone(const node& src);
+    static void update(node& dst) noexcept;
+    static node_list split_leaf(node& dst);
+    static node_list split_inner(node& dst);
+    static node_list insert_node(node& dst, uint_t pos, const char_t* it, const char_t* last, const rope_metrics& metrics);
+    static rope_metrics erase_node(node& dst, uint_t pos, uint_t count);
+    static void merge_nodes(node& dst, uint_t index);
+    template<typename func_t>
+    static bool visit_chunks(const node& src, uint_t& pos, uint_t& count, func_t& func);
+
+private:
+    node_ptr m_root;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// rope_metrics
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+constexpr uint_t rope_metrics::code_units() const noexcept
+{
+    if constexpr (sizeof(char_t) == sizeof(char))
+        return utf8_units;
+    else if constexpr (sizeof(char_t) == sizeof(char16_t))
+        return utf16_units;
+    else
+        return code_points;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr rope_metrics& rope_metrics::operator+=(const rope_metrics& other) noexcept
+{
+    code_points += other.code_points;
+    utf8_units += other.utf8_units;
+    utf16_units += other.utf16_units;
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr rope_metrics& rope_metrics::operator-=(const rope_metrics& other) noexcept
+{
+    code_points -= other.code_points;
+    utf8_units -= other.utf8_units;
+    utf16_units -= other.utf16_units;
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// rope
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline rope<char_t>::rope()
+    : m_root(std::make_unique<node>())
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline rope<char_t>::rope(const std::basic_string_view<char_t>& str)
+    : rope()
+{
+    insert(0, str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline rope<char_t>::rope(const rope& other)
+    : m_root(clone(other.root()))
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline rope<char_t>& rope<char_t>::operator=(const rope& other)
+{
+    if (this != &other)
+        m_root = clone(other.root());
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t rope<char_t>::size() const noexcept
+{
+    return root().metrics.template code_units<char_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t rope<char_t>::length() const noexcept
+{
+    return root().metrics.code_points;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool rope<char_t>::empty() const noexcept
+{
+    return root().metrics.code_points == 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const rope_metrics& rope<char_t>::metrics() const noexcept
+{
+    return root().metrics;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void rope<char_t>::insert(uint_t pos, const std::basic_string_view<char_t>& str)
+{
+    if (pos > length())
+        throw std::out_of_range("Code point position is out of rope range.");
+
+    if (str.empty())
+        return;
+
+    const char_t* it = str.data();
+    const char_t* last = it + str.size();
+
+    if (!m_root)
+        m_root = std::make_unique<node>();
+
+    node_list extra = insert_node(*m_root, pos, it, last, measure(it, last));
+
+    // grow the tree from the root while the nodes split
+
+    while (!extra.empty()) {
+
+        extra.insert(extra.begin(), std::move(m_root));
+        m_root = make_inner(extra.begin(), extra.end());
+        extra = m_root->children.size() > max_node_size ? split_inner(*m_root) : node_list();
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+template<typename charsrc_t>
+inline void rope<char_t>::insert(uint_t pos, const std::basic_string_view<charsrc_t>& str)
+{
+    insert(pos, std::basic_string_view<char_t>(sutf::to_anystring<char_t>(str)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void rope<char_t>::append(const std::basic_string_view<char_t>& str)
+{
+    insert(length(), str);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void rope<char_t>::erase(uint_t pos, uint_t count)
+{
+    if (pos > length())
+        throw std::out_of_range("Code point position is out of rope range.");
+
+    count = std::min(count, length() - pos);
+
+    if (count == 0)
+        return;
+
+    erase_node(*m_root, pos, count);
+
+    // shrink the tree from the root while it has single child
+
+    while (!m_root->leaf && m_root->children.size() == 1)
+        m_root = std::move(m_root->children.front());
+
+    if (!m_root->leaf && m_root->children.empty())
+        m_root = std::make_unique<node>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void rope<char_t>::clear()
+{
+    m_root = std::make_unique<node>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+template<typename charunit_t>
+inline uint_t rope<char_t>::code_unit_offset(uint_t pos) const
+{
+    if (pos > length())
+        throw std::out_of_range("Code point position is out of rope range.");
+
+    const node* current = &root();
+    uint_t offset = 0;
+
+    while (!current->leaf) {
+
+        const node_list& children = current->children;
+        auto it = children.begin();
+
+        for (; pos > (*it)->metrics.code_points && it + 1 != children.end(); ++it) {
+
+            pos -= (*it)->metrics.code_points;
+            offset += (*it)->metrics.template code_units<charunit_t>();
+        }
+
+        current = it->get();
+    }
+
+    const char_t* first = current->text.data();
+    const char_t* last = first + leaf_offset(current->text, 0, pos);
+
+    return offset + code_unit_count<charunit_t>(first, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+template<typename charunit_t>
+inline uint_t rope<char_t>::code_point_offset(uint_t offset) const
+{
+    if (offset > root().metrics.template code_units<charunit_t>())
+        throw std::out_of_range("Code unit offset is out of rope range.");
+
+    const node* current = &root();
+    uint_t pos = 0;
+
+    while (!current->leaf) {
+
+        const node_list& children = current->children;
+        auto it = children.begin();
+
+        for (; offset >= (*it)->metrics.template code_units<charunit_t>() && it + 1 != children.end(); ++it) {
+
+            offset -= (*it)->metrics.template code_units<charunit_t>();
+            pos += (*it)->metrics.code_points;
+        }
+
+        current = it->get();
+    }
+
+    // offset inside of code point is rounded down to the code point start
+
+    const char_t* it = current->text.data();
+    const char_t* last = it + current->text.size();
+
+    for (; it < last; it = code_point_next(it), ++pos) {
+
+        const uint_t size = code_unit_count<charunit_t>(code_point_read(it));
+
+        if (offset < size)
+            break;
+
+        offset -= size;
+    }
+
+    return pos;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline std::basic_string<char_t> rope<char_t>::substr(uint_t pos, uint_t count) const
+{
+    if (pos > length())
+        throw std::out_of_range("Code point position is out of rope range.");
+
+    count = std::min(count, length() - pos);
+
+    std::basic_string<char_t> out;
+    auto append_chunk = [&out](const std::basic_string_view<char_t>& chunk) { out.append(chunk.data(), chunk.size()); };
+
+    if (count != 0)
+        visit_chunks(root(), pos, count, append_chunk);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline std::basic_string<char_t> rope<char_t>::str() const
+{
+    std::basic_string<char_t> out;
+    out.reserve(size());
+
+    for_each_chunk([&out](const std::basic_string_view<char_t>& chunk) { out.append(chunk.data(), chunk.size()); });
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+template<typename func_t>
+inline void rope<char_t>::for_each_chunk(func_t&& func) const
+{
+    uint_t pos = 0;
+    uint_t count = length();
+
+    if (count != 0)
+        visit_chunks(root(), pos, count, func);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const typename rope<char_t>::node& rope<char_t>::root() const noexcept
+{
+    // moved from rope has no root and behaves as empty one until the next insertion
+
+    static const node empty_root;
+
+    return m_root ? *m_root : empty_root;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline rope_metrics rope<char_t>::measure(const char_t* it, const char_t* last) noexcept
+{
+    const impl::unit_lengths lengths = impl::measure_units(it, last);
+
+    return { lengths.code_points, lengths.utf8_size, lengths.utf16_size };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t rope<char_t>::leaf_offset(const std::basic_string<char_t>& text, uint_t offset, uint_t pos) noexcept
+{
+    // code unit offset of the code point located pos code points after the offset
+
+    const char_t* first = text.data();
+    const char_t* last = first + text.size();
+    const char_t* it = first + offset;
+
+    for (; pos != 0 && it < last; --pos)
+        it = code_point_next(it);
+
+    return std::min(it, last) - first;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename rope<char_t>::node_ptr rope<char_t>::make_leaf(const char_t* it, const char_t* last)
+{
+    node_ptr leaf = std::make_unique<node>();
+
+    leaf->text.assign(it, last);
+    leaf->metrics = measure(it, last);
+
+    return leaf;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename rope<char_t>::node_ptr rope<char_t>::make_inner(typename node_list::iterator it, typename node_list::iterator last)
+{
+    node_ptr inner = std::make_unique<node>();
+
+    inner->leaf = false;
+    inner->children.assign(std::make_move_iterator(it), std::make_move_iterator(last));
+    update(*inner);
+
+    return inner;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename rope<char_t>::node_ptr rope<char_t>::clone(const node& src)
+{
+    node_ptr dst = std::make_unique<node>();
+
+    dst->metrics = src.metrics;
+    dst->leaf = src.leaf;
+    dst->text = src.text;
+    dst->children.reserve(src.children.size());
+
+    for (const node_ptr& child : src.children)
+        dst->children.push_back(clone(*child));
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void rope<char_t>::update(node& dst) noexcept
+{
+    dst.metrics = rope_metrics();
+
+    for (const node_ptr& child : dst.children)
+        dst.metrics += child->metrics;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename rope<char_t>::node_list rope<char_t>::split_leaf(node& dst)
+{
+    // cut the text into chunks of about 3/4 of maximum size on code point boundaries
+
+    std::basic_string<char_t> text;
+    text.swap(dst.text);
+
+    const uint_t chunk_size = text.size() / ((text.size() + max_leaf_size * 3 / 4 - 1) / (max_leaf_size * 3 / 4));
+
+    const char_t* it = text.data();
+    const char_t* last = it + text.size();
+
+    node_list extra;
+
+    while (it != last) {
+
+        const char_t* cut = last;
+
+        if (static_cast<uint_t>(last - it) > max_leaf_size) {
+
+            cut = it;
+
+            while (cut < last && static_cast<uint_t>(cut - it) < chunk_size)
+                cut = code_point_next(cut);
+
+            cut = std::min(cut, last);
+        }
+
+        if (it == text.data()) {
+
+            dst.text.assign(it, cut);
+            dst.metrics = measure(it, cut);
+
+        } else {
+
+            extra.push_back(make_leaf(it, cut));
+        }
+
+        it = cut;
+    }
+
+    return extra;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename rope<char_t>::node_list rope<char_t>::split_inner(node& dst)
+{
+    // distribute children evenly between the node and the new right siblings
+
+    node_list children = std::move(dst.children);
+    const uint_t count = (children.size() + max_node_size - 1) / max_node_size;
+
+    node_list extra;
+
+    for (uint_t index = 0; index != count; ++index) {
+
+        const auto it = children.begin() + children.size() * index / count;
+        const auto last = children.begin() + children.size() * (index + 1) / count;
+
+        if (index == 0) {
+
+            dst.children.assign(std::make_move_iterator(it), std::make_move_iterator(last));
+            update(dst);
+
+        } else {
+
+            extra.push_back(make_inner(it, last));
+        }
+    }
+
+    return extra;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename rope<char_t>::node_list rope<char_t>::insert_node(node& dst, uint_t pos, const char_t* it, const char_t* last, const rope_metrics& metrics)
+{
+    dst.metrics += metrics;
+
+    if (dst.leaf) {
+
+        dst.text.insert(leaf_offset(dst.text, 0, pos), it, last - it);
+
+        return dst.text.size() > max_leaf_size ? split_leaf(dst) : node_list();
+    }
+
+    // insertion at the boundary of two children goes to the left one
+
+    node_list& children = dst.children;
+    uint_t index = 0;
+
+    for (; pos > children[index]->metrics.code_points && index + 1 != children.size(); ++index)
+        pos -= children[index]->metrics.code_points;
+
+    node_list extra = insert_node(*children[index], pos, it, last, metrics);
+
+    if (extra.empty())
+        return extra;
+
+    children.insert(children.begin() + index + 1, std::make_move_iterator(extra.begin()), std::make_move_iterator(extra.end()));
+
+    return children.size() > max_node_size ? split_inner(dst) : node_list();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline rope_metrics rope<char_t>::erase_node(node& dst, uint_t pos, uint_t count)
+{
+    rope_metrics removed;
+
+    if (dst.leaf) {
+
+        const uint_t first = leaf_offset(dst.text, 0, pos);
+        const uint_t last = leaf_offset(dst.text, first, count);
+
+        removed = measure(dst.text.data() + first, dst.text.data() + last);
+        dst.text.erase(first, last - first);
+
+    } else {
+
+        node_list& children = dst.children;
+        uint_t start = 0;
+
+        for (uint_t index = 0; index != children.size() && count != 0; ++index) {
+
+            const uint_t size = children[index]->metrics.code_points;
+
+            if (pos < start + size) {
+
+                const uint_t offset = pos - start;
+                const uint_t length = std::min(count, size - offset);
+
+                removed += erase_node(*children[index], offset, length);
+                pos += length;
+                count -= length;
+            }
+
+            start += size;
+        }
+
+        // drop emptied children and rebalance the underfilled ones with their neighbors
+
+        children.erase(std::remove_if(children.begin(), children.end(), [](const node_ptr& child) { return child->metrics.code_points == 0; }), children.end());
+
+        for (uint_t index = 0; index < children.size() && children.size() > 1;) {
+
+            const node& child = *children[index];
+            const bool underfilled = child.leaf ? child.text.size() < min_leaf_size : child.children.size() < min_node_size;
+
+            if (underfilled) {
+
+                index = index == 0 ? 0 : index - 1;
+                merge_nodes(dst, index);
+
+            } else {
+
+                ++index;
+            }
+        }
+    }
+
+    dst.metrics -= removed;
+
+    return removed;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void rope<char_t>::merge_nodes(node& dst, uint_t index)
+{
+    // merge two adjacent children and split the result again if it overflows
+
+    node_list& children = dst.children;
+    node& left = *children[index];
+    node& right = *children[index + 1];
+
+    node_list extra;
+
+    if (left.leaf) {
+
+        left.text.append(right.text);
+        left.metrics += right.metrics;
+
+        if (left.text.size() > max_leaf_size)
+            extra = split_leaf(left);
+
+    } else {
+
+        left.children.insert(left.children.end(), std::make_move_iterator(right.children.begin()), std::make_move_iterator(right.children.end()));
+        update(left);
+
+        if (left.children.size() > max_node_size)
+            extra = split_inner(left);
+    }
+
+    children.erase(children.begin() + index + 1);
+    children.insert(children.begin() + index + 1, std::make_move_iterator(extra.begin()), std::make_move_iterator(extra.end()));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+template<typename func_t>
+inline bool rope<char_t>::visit_chunks(const node& src, uint_t& pos, uint_t& count, func_t& func)
+{
+    // pass chunks overlapping the code point range to the function, returns false when done
+
+    if (src.leaf) {
+
+        const uint_t first = leaf_offset(src.text, 0, pos);
+        const uint_t last = leaf_offset(src.text, first, count);
+
+        func(std::basic_string_view<char_t>(src.text.data() + first, last - first));
+
+        count -= std::min(count, src.metrics.code_points - pos);
+        pos = 0;
+
+        return count != 0;
+    }
+
+    for (const node_ptr& child : src.children) {
+
+        if (pos >= child->metrics.code_points) {
+
+            pos -= child->metrics.code_points;
+            continue;
+        }
+
+        if (!visit_chunks(*child, pos, count, func))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_rope.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
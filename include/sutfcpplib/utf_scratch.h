@@ -0,0 +1,336 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+
+#include <memory>
+#include <vector>
+
+// scratch buffers larger than the capacity in code units are released instead of being reused,
+// so that converting one large string doesn't pin memory
+
+#if !defined(SUTF_SCRATCH_CAPACITY)
+#define SUTF_SCRATCH_CAPACITY 65536
+#endif // SUTF_SCRATCH_CAPACITY
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+template<typename char_t>
+struct scratch_buffer
+{
+    std::unique_ptr<char_t[]> data;
+    uint_t capacity = 0;
+};
+
+template<typename char_t>
+struct scratch_pool
+{
+    static constexpr uint_t max_spare = 4;
+
+    scratch_buffer<char_t> current;
+    std::vector<scratch_buffer<char_t>> spare;
+
+    scratch_pool()
+    {
+        spare.reserve(max_spare);
+    }
+};
+
+template<typename char_t>
+scratch_pool<char_t>& thread_scratch_pool();
+template<typename char_t>
+void scratch_reserve(scratch_buffer<char_t>& buffer, uint_t size);
+template<typename chardst_t, typename type_t>
+uint_t scratch_convert(const type_t& str, scratch_buffer<chardst_t>& buffer);
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// scratch_lease
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// converted string in buffer borrowed from thread local pool, the buffer is returned to the pool
+// on destruction, so the lease must be destroyed by the thread which created it
+
+template<typename char_t>
+class scratch_lease
+{
+public:
+    scratch_lease() noexcept = default;
+    scratch_lease(scratch_lease&& other) noexcept;
+    scratch_lease& operator=(scratch_lease&& other) noexcept;
+    ~scratch_lease();
+
+    const char_t* data() const noexcept;
+    uint_t size() const noexcept;
+    std::basic_string_view<char_t> view() const noexcept;
+    operator std::basic_string_view<char_t>() const noexcept;
+
+private:
+    template<typename chardst_t, typename type_t>
+    friend auto lease_scratch(const type_t& str) -> decltype(std::cbegin(str), scratch_lease<chardst_t>());
+
+    void release() noexcept;
+
+private:
+    impl::scratch_buffer<char_t> m_buffer;
+    uint_t m_size = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// convert string of any encoding to thread local buffer, the view is valid until the next call
+// with the same destination type on the same thread
+
+template<typename chardst_t, typename type_t>
+auto to_scratch(const type_t& str) -> decltype(std::cbegin(str), std::basic_string_view<chardst_t>());
+
+// convert string of any encoding to buffer leased from thread local pool
+
+template<typename chardst_t, typename type_t>
+auto lease_scratch(const type_t& str) -> decltype(std::cbegin(str), scratch_lease<chardst_t>());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// scratch_lease
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline scratch_lease<char_t>::scratch_lease(scratch_lease&& other) noexcept
+    : m_buffer(std::move(other.m_buffer))
+    , m_size(other.m_size)
+{
+    other.m_buffer.capacity = 0;
+    other.m_size = 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline scratch_lease<char_t>& scratch_lease<char_t>::operator=(scratch_lease&& other) noexcept
+{
+    if (this != &other) {
+
+        release();
+
+        m_buffer = std::move(other.m_buffer);
+        m_size = other.m_size;
+        other.m_buffer.capacity = 0;
+        other.m_size = 0;
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline scratch_lease<char_t>::~scratch_lease()
+{
+    release();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* scratch_lease<char_t>::data() const noexcept
+{
+    return m_buffer.data.get();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t scratch_lease<char_t>::size() const noexcept
+{
+    return m_size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline std::basic_string_view<char_t> scratch_lease<char_t>::view() const noexcept
+{
+    return { m_buffer.data.get(), m_size };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline scratch_lease<char_t>::operator std::basic_string_view<char_t>() const noexcept
+{
+    return view();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void scratch_lease<char_t>::release() noexcept
+{
+    // keep a few buffers within the capacity for the next leases, the pool exists since
+    // the lease was created by the same thread
+
+    if (m_buffer.data && m_buffer.capacity <= SUTF_SCRATCH_CAPACITY) {
+
+        impl::scratch_pool<char_t>& pool = impl::thread_scratch_pool<char_t>();
+
+        if (pool.spare.size() < pool.max_spare)
+            pool.spare.push_back(std::move(m_buffer));
+    }
+
+    m_buffer = {};
+    m_size = 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename chardst_t, typename type_t>
+inline auto to_scratch(const type_t& str) -> decltype(std::cbegin(str), std::basic_string_view<chardst_t>())
+{
+    impl::scratch_buffer<chardst_t>& buffer = impl::thread_scratch_pool<chardst_t>().current;
+    const uint_t size = impl::scratch_convert(str, buffer);
+
+    return { buffer.data.get(), size };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline auto lease_scratch(const type_t& str) -> decltype(std::cbegin(str), scratch_lease<chardst_t>())
+{
+    impl::scratch_pool<chardst_t>& pool = impl::thread_scratch_pool<chardst_t>();
+    scratch_lease<chardst_t> lease;
+
+    if (!pool.spare.empty()) {
+
+        lease.m_buffer = std::move(pool.spare.back());
+        pool.spare.pop_back();
+    }
+
+    lease.m_size = impl::scratch_convert(str, lease.m_buffer);
+
+    return lease;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline scratch_pool<char_t>& thread_scratch_pool()
+{
+    thread_local scratch_pool<char_t> pool;
+
+    return pool;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void scratch_reserve(scratch_buffer<char_t>& buffer, uint_t size)
+{
+    // buffer over the capacity is dropped before the next conversion, so only the last outlier
+    // is kept
+
+    if (buffer.capacity > SUTF_SCRATCH_CAPACITY && size <= SUTF_SCRATCH_CAPACITY)
+        buffer = {};
+
+    if (size <= buffer.capacity)
+        return;
+
+    const uint_t capacity = std::max<uint_t>(size, std::min<uint_t>(buffer.capacity * 2, SUTF_SCRATCH_CAPACITY));
+
+    buffer.data.reset();
+    buffer.data.reset(new char_t[capacity]);
+    buffer.capacity = capacity;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename type_t>
+inline uint_t scratch_convert(const type_t& str, scratch_buffer<chardst_t>& buffer)
+{
+    // reserve for the longest result to convert in one pass
+
+    const auto [first, last] = code_units_of(str);
+    using charsrc_t = typename std::iterator_traits<std::remove_const_t<decltype(first)>>::value_type;
+
+    scratch_reserve(buffer, std::max<uint_t>(max_code_units<chardst_t, charsrc_t>(last - first), 1));
+
+    if constexpr (std::is_pointer_v<std::remove_const_t<decltype(first)>>)
+        return transcode(first, last, buffer.data.get()) - buffer.data.get();
+    else
+        return code_point_convert(first, last, buffer.data.get()) - buffer.data.get();
+}
+
+} // namespace impl
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_scratch.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
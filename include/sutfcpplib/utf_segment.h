@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+#include "utf_stream.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// convert segmented source to string of any encoding, the source is a range of contiguous strings,
+// such as std::vector<std::u16string_view> for chain of buffers, or a container of code units
+// with non-contiguous storage, such as std::deque<char16_t>, every segment is converted by bulk
+// kernels and code point split by segment boundary is completed by the next segment, invalid
+// sequences split by segment boundary may be replaced differently than in contiguous string, the
+// second form appends to the destination string
+
+template<typename chardst_t, typename segments_t>
+auto convert_segments(const segments_t& segments) -> decltype(std::cbegin(segments), std::basic_string<chardst_t>());
+template<typename chardst_t, typename segments_t>
+auto convert_segments(const segments_t& segments, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(segments), void());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// converter of contiguous segments of source, incomplete code point at the end of segment is kept
+// in carry buffer until following segments complete it
+
+template<typename chardst_t, typename charsrc_t>
+class segment_converter
+{
+public:
+    explicit segment_converter(std::basic_string<chardst_t>& out) noexcept
+        : m_out(out)
+    {
+    }
+
+    void append(const charsrc_t* it, const charsrc_t* last)
+    {
+        while (m_carry_size != 0) {
+
+            // the lead unit defines the size of carried code point, invalid lead may leave units
+            // for the next code point in the buffer
+
+            const uint_t size = code_point_next(m_carry) - m_carry;
+
+            if (m_carry_size < size) {
+
+                const uint_t count = std::min<uint_t>(size - m_carry_size, last - it);
+
+                std::copy(it, it + count, m_carry + m_carry_size);
+                m_carry_size += count;
+                it += count;
+
+                if (m_carry_size != size)
+                    return;
+            }
+
+            append_units(m_out, m_carry, m_carry + size);
+            std::copy(m_carry + size, m_carry + m_carry_size, m_carry);
+            m_carry_size -= size;
+        }
+
+        const charsrc_t* end = complete_end(it, last);
+
+        append_units(m_out, it, end);
+        std::copy(end, last, m_carry);
+        m_carry_size = last - end;
+    }
+
+    void finish()
+    {
+        // code point truncated by the end of source is converted as is
+
+        append_units(m_out, m_carry, m_carry + m_carry_size);
+        m_carry_size = 0;
+    }
+
+private:
+    std::basic_string<chardst_t>& m_out;
+    charsrc_t m_carry[4] = {};
+    uint_t m_carry_size = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename segments_t>
+constexpr auto segment_units_of(const segments_t& segments) noexcept
+{
+    // pointer to the first code unit of segments, the routine defines code unit type of the source
+
+    using value_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::cbegin(segments))>>;
+
+    if constexpr (is_any_char_v<value_t>)
+        return static_cast<const value_t*>(nullptr);
+    else
+        return code_units_of(*std::cbegin(segments)).first;
+}
+
+template<typename segments_t>
+using segment_char_t = std::remove_cv_t<std::remove_pointer_t<decltype(segment_units_of(std::declval<const segments_t&>()))>>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename segments_t, typename func_t>
+inline void for_each_segment(const segments_t& segments, func_t func)
+{
+    // contiguous string is one segment, containers of code units with other storage are copied to
+    // stack buffer in chunks, std::copy moves whole blocks of std::deque, elements of the other
+    // ranges are segments
+
+    using value_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::cbegin(segments))>>;
+
+    if constexpr (is_any_char_v<value_t> && (is_contiguous_string_v<segments_t> || is_char_array_v<segments_t>)) {
+
+        const auto [first, last] = code_units_of(segments);
+        func(first, last);
+
+    } else if constexpr (is_any_char_v<value_t>) {
+
+        constexpr uint_t chunk = 1024;
+        value_t buffer[chunk];
+
+        for (auto it = std::cbegin(segments), last = std::cend(segments); it != last;) {
+
+            const uint_t count = std::min<uint_t>(chunk, last - it);
+
+            std::copy(it, it + count, buffer);
+            func(static_cast<const value_t*>(buffer), static_cast<const value_t*>(buffer) + count);
+            it += count;
+        }
+
+    } else {
+
+        static_assert(is_contiguous_string_v<value_t>, "Only contiguous strings can be segments.");
+
+        for (const value_t& segment : segments) {
+
+            const auto [first, last] = code_units_of(segment);
+            func(first, last);
+        }
+    }
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename chardst_t, typename segments_t>
+inline auto convert_segments(const segments_t& segments) -> decltype(std::cbegin(segments), std::basic_string<chardst_t>())
+{
+    std::basic_string<chardst_t> out;
+    convert_segments(segments, out);
+
+    return out;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename chardst_t, typename segments_t>
+inline auto convert_segments(const segments_t& segments, std::basic_string<chardst_t>& out) -> decltype(std::cbegin(segments), void())
+{
+    using charsrc_t = impl::segment_char_t<segments_t>;
+    impl::segment_converter<chardst_t, charsrc_t> converter(out);
+
+    impl::for_each_segment(segments, [&](const charsrc_t* it, const charsrc_t* last) { converter.append(it, last); });
+    converter.finish();
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_segment.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,949 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_codepoint.h"
+#include "utf_instrument.h"
+
+#include <cstring>
+
+// SIMD support is detected from compiler target flags, define SUTF_NO_SIMD to use scalar code only
+
+#if !defined(SUTF_NO_SIMD)
+#if defined(__AVX2__)
+#define SUTF_SIMD_AVX2
+#endif
+#if defined(__SSSE3__) || defined(__AVX__) || defined(SUTF_SIMD_AVX2)
+#define SUTF_SIMD_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(SUTF_SIMD_SSSE3)
+#define SUTF_SIMD_SSE2
+#endif
+#endif // SUTF_NO_SIMD
+
+#if defined(SUTF_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(SUTF_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(SUTF_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+
+template<typename char_t>
+using unit_t = std::conditional_t<sizeof(char_t) == sizeof(std::uint8_t), std::uint8_t,
+    std::conditional_t<sizeof(char_t) == sizeof(std::uint16_t), std::uint16_t, std::uint32_t>>;
+
+// tier of bulk kernels selected by compiler target flags
+
+#if defined(SUTF_SIMD_AVX2)
+inline constexpr kernel_tier simd_tier = kernel_tier::avx2;
+#elif defined(SUTF_SIMD_SSSE3)
+inline constexpr kernel_tier simd_tier = kernel_tier::ssse3;
+#elif defined(SUTF_SIMD_SSE2)
+inline constexpr kernel_tier simd_tier = kernel_tier::sse2;
+#else
+inline constexpr kernel_tier simd_tier = kernel_tier::scalar;
+#endif
+
+// lengths of code unit sequence in code points and in code units of other encodings
+
+struct unit_lengths
+{
+    uint_t code_points;
+    uint_t utf8_size;
+    uint_t utf16_size;
+    uint_t non_ascii;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bit manipulation
+
+inline uint_t bit_scan(std::uint32_t mask) noexcept;
+inline uint_t bit_count(std::uint64_t mask) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bulk kernels
+
+template<uint_t bits, typename char_t>
+inline const char_t* unit_bound_end(const char_t* it, const char_t* last) noexcept;
+template<typename char_t>
+inline const char_t* ascii_end(const char_t* it, const char_t* last) noexcept;
+template<typename char_t>
+inline uint_t non_ascii_count(const char_t* it, const char_t* last) noexcept;
+template<typename char_t>
+inline uint_t unit_max(const char_t* it, const char_t* last) noexcept;
+template<typename char_t>
+inline const char_t* surrogate_find(const char_t* it, const char_t* last) noexcept;
+template<typename char_t>
+inline uint_t unit_mismatch(const char_t* lhs, const char_t* rhs, uint_t size) noexcept;
+template<typename lhs_t, typename rhs_t>
+inline uint_t ascii_prefix(const lhs_t* lhs, const rhs_t* rhs, uint_t size) noexcept;
+template<typename char_t>
+inline uint_t continuation_count(const char_t* it, const char_t* last) noexcept;
+template<typename char_t>
+inline const char_t* unit_search(const char_t* it, const char_t* last, const char_t* needle, uint_t size) noexcept;
+template<typename char_t>
+inline const char_t* code_point_skip(const char_t* it, const char_t* last, uint_t count) noexcept;
+template<typename char_t>
+inline unit_lengths measure_units(const char_t* it, const char_t* last) noexcept;
+template<typename dst_t, typename src_t>
+inline dst_t* widen(const src_t* it, const src_t* last, dst_t* dst) noexcept;
+template<typename dst_t, typename src_t>
+inline dst_t* narrow(const src_t* it, const src_t* last, dst_t* dst) noexcept;
+template<typename dst_t, typename src_t>
+inline dst_t* copy_units(const src_t* it, const src_t* last, dst_t* dst) noexcept;
+template<typename dst_t, typename src_t>
+inline dst_t* unpack_code_points(const src_t* it, const src_t* last, dst_t* dst) noexcept;
+template<typename dst_t, typename src_t>
+inline dst_t* pack_code_points(const src_t* it, const src_t* last, dst_t* dst) noexcept;
+template<typename dst_t, typename src_t>
+inline dst_t* transcode(const src_t* it, const src_t* last, dst_t* dst) noexcept;
+template<typename dst_t, typename src_t>
+constexpr uint_t max_code_units(uint_t size) noexcept;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bit manipulation
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline uint_t bit_scan(std::uint32_t mask) noexcept
+{
+    assert(mask != 0);
+
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t bit_count(std::uint64_t mask) noexcept
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    return __popcnt64(mask);
+#elif defined(_MSC_VER)
+    return __popcnt(static_cast<std::uint32_t>(mask)) + __popcnt(static_cast<std::uint32_t>(mask >> 32));
+#else
+    return __builtin_popcountll(mask);
+#endif
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bulk kernels
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<uint_t bits, typename char_t>
+inline const char_t* unit_bound_end(const char_t* it, const char_t* last) noexcept
+{
+    // find first code unit greater or equal to 2^bits
+
+    static_assert(bits >= 7 && bits < sizeof(char_t) * CHAR_BIT);
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    for (; last - it >= static_cast<int_t>(block); it += block) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        std::uint32_t mask;
+
+        if constexpr (sizeof(char_t) == 1) {
+            mask = _mm_movemask_epi8(units);
+        } else if constexpr (sizeof(char_t) == 2) {
+            const __m128i high = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xffff << bits)));
+            mask = _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) ^ 0xffff;
+        } else {
+            const __m128i high = _mm_and_si128(units, _mm_set1_epi32(static_cast<int>(0xffffffff << bits)));
+            mask = _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) ^ 0xffff;
+        }
+
+        if (mask != 0)
+            return it + bit_scan(mask) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    while (it != last && (static_cast<unit_t<char_t>>(*it) >> bits) == 0)
+        ++it;
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* ascii_end(const char_t* it, const char_t* last) noexcept
+{
+    return unit_bound_end<7>(it, last);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t non_ascii_count(const char_t* it, const char_t* last) noexcept
+{
+    static_assert(sizeof(char_t) == 1);
+
+    uint_t count = 0;
+
+#if defined(SUTF_SIMD_SSE2)
+    for (; last - it >= 16; it += 16)
+        count += bit_count(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it))));
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it)
+        count += static_cast<unit_t<char_t>>(*it) >> 7;
+
+    return count;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t unit_max(const char_t* it, const char_t* last) noexcept
+{
+    uint_t max = 0;
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    if (last - it >= static_cast<int_t>(block)) {
+
+        // signed comparison is used for wide units, so the sign bit is flipped before and after
+
+        const __m128i bias = sizeof(char_t) == 1 ? _mm_setzero_si128() : sizeof(char_t) == 2 ? _mm_set1_epi16(static_cast<short>(0x8000)) : _mm_set1_epi32(static_cast<int>(0x80000000));
+        __m128i acc = bias;
+
+        for (; last - it >= static_cast<int_t>(block); it += block) {
+
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+            if constexpr (sizeof(char_t) == 1) {
+                acc = _mm_max_epu8(acc, units);
+            } else if constexpr (sizeof(char_t) == 2) {
+                acc = _mm_max_epi16(acc, _mm_xor_si128(units, bias));
+            } else {
+                const __m128i value = _mm_xor_si128(units, bias);
+                const __m128i greater = _mm_cmpgt_epi32(value, acc);
+                acc = _mm_or_si128(_mm_and_si128(greater, value), _mm_andnot_si128(greater, acc));
+            }
+        }
+
+        alignas(16) unit_t<char_t> lanes[block];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_xor_si128(acc, bias));
+
+        for (const unit_t<char_t> lane : lanes)
+            max = lane > max ? lane : max;
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it) {
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*it);
+        max = unit > max ? unit : max;
+    }
+
+    return max;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* surrogate_find(const char_t* it, const char_t* last) noexcept
+{
+    static_assert(sizeof(char_t) == sizeof(char16_t));
+
+#if defined(SUTF_SIMD_SSE2)
+    for (; last - it >= 8; it += 8) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const __m128i masked = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xf800)));
+        const std::uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi16(masked, _mm_set1_epi16(static_cast<short>(0xd800))));
+
+        if (mask != 0)
+            return it + bit_scan(mask) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    while (it != last && (static_cast<char16_t>(*it) & 0xf800) != 0xd800)
+        ++it;
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t unit_mismatch(const char_t* lhs, const char_t* rhs, uint_t size) noexcept
+{
+    // find index of the first different code unit of two buffers
+
+    uint_t index = 0;
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    for (; size - index >= block; index += block) {
+
+        const __m128i lhs_units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+        const __m128i rhs_units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+        const std::uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(lhs_units, rhs_units)) ^ 0xffff;
+
+        if (mask != 0)
+            return index + bit_scan(mask) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    while (index != size && lhs[index] == rhs[index])
+        ++index;
+
+    return index;
+}
+
+
+
+#if defined(SUTF_SIMD_SSE2)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline __m128i ascii_block(const char_t* it, std::uint32_t& mask) noexcept
+{
+    // load 16 code units as bytes, the mask marks lanes holding ASCII characters
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i* in = reinterpret_cast<const __m128i*>(it);
+
+    if constexpr (sizeof(char_t) == 1) {
+
+        const __m128i units = _mm_loadu_si128(in);
+        mask = _mm_movemask_epi8(units) ^ 0xffff;
+        return units;
+
+    } else if constexpr (sizeof(char_t) == 2) {
+
+        const __m128i lo = _mm_loadu_si128(in + 0);
+        const __m128i hi = _mm_loadu_si128(in + 1);
+        const __m128i ascii_lo = _mm_cmpeq_epi16(_mm_and_si128(lo, _mm_set1_epi16(static_cast<short>(0xff80))), zero);
+        const __m128i ascii_hi = _mm_cmpeq_epi16(_mm_and_si128(hi, _mm_set1_epi16(static_cast<short>(0xff80))), zero);
+
+        mask = _mm_movemask_epi8(_mm_packs_epi16(ascii_lo, ascii_hi));
+        return _mm_packus_epi16(_mm_and_si128(lo, ascii_lo), _mm_and_si128(hi, ascii_hi));
+
+    } else {
+
+        __m128i units[4];
+        __m128i ascii[4];
+
+        for (uint_t index = 0; index != 4; ++index) {
+
+            units[index] = _mm_loadu_si128(in + index);
+            ascii[index] = _mm_cmpeq_epi32(_mm_and_si128(units[index], _mm_set1_epi32(static_cast<int>(0xffffff80))), zero);
+            units[index] = _mm_and_si128(units[index], ascii[index]);
+        }
+
+        const __m128i ascii16 = _mm_packs_epi16(_mm_packs_epi32(ascii[0], ascii[1]), _mm_packs_epi32(ascii[2], ascii[3]));
+        mask = _mm_movemask_epi8(ascii16);
+
+        return _mm_packus_epi16(_mm_packs_epi32(units[0], units[1]), _mm_packs_epi32(units[2], units[3]));
+    }
+}
+#endif // SUTF_SIMD_SSE2
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename lhs_t, typename rhs_t>
+inline uint_t ascii_prefix(const lhs_t* lhs, const rhs_t* rhs, uint_t size) noexcept
+{
+    // length of the common prefix of ASCII characters of two buffers of any code unit width
+
+    uint_t index = 0;
+
+#if defined(SUTF_SIMD_SSE2)
+    for (; size - index >= 16; index += 16) {
+
+        std::uint32_t lhs_mask;
+        std::uint32_t rhs_mask;
+
+        const __m128i lhs_units = ascii_block(lhs + index, lhs_mask);
+        const __m128i rhs_units = ascii_block(rhs + index, rhs_mask);
+        const std::uint32_t mask = (_mm_movemask_epi8(_mm_cmpeq_epi8(lhs_units, rhs_units)) & lhs_mask & rhs_mask) ^ 0xffff;
+
+        if (mask != 0)
+            return index + bit_scan(mask);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; index != size; ++index) {
+
+        const uint_t unit = static_cast<unit_t<lhs_t>>(lhs[index]);
+
+        if (unit >= 0x80 || unit != static_cast<unit_t<rhs_t>>(rhs[index]))
+            break;
+    }
+
+    return index;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline uint_t continuation_count(const char_t* it, const char_t* last) noexcept
+{
+    // count code units which don't start code points, UTF-8 continuation bytes or UTF-16 low
+    // surrogates, so that the number of code points is the number of units minus the count
+
+    uint_t count = 0;
+
+    if constexpr (sizeof(char_t) != 4) {
+
+#if defined(SUTF_SIMD_SSE2)
+        // lanes count matching units and are summed up before they overflow
+
+        constexpr uint_t block = 16 / sizeof(char_t);
+        constexpr uint_t lane_max = sizeof(char_t) == 1 ? 255 : 32767;
+
+        while (last - it >= static_cast<int_t>(block)) {
+
+            __m128i acc = _mm_setzero_si128();
+
+            for (uint_t index = 0; index != lane_max && last - it >= static_cast<int_t>(block); ++index, it += block) {
+
+                const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+                if constexpr (sizeof(char_t) == 1) {
+                    acc = _mm_sub_epi8(acc, _mm_cmplt_epi8(units, _mm_set1_epi8(static_cast<char>(0xc0))));
+                } else {
+                    const __m128i masked = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xfc00)));
+                    acc = _mm_sub_epi16(acc, _mm_cmpeq_epi16(masked, _mm_set1_epi16(static_cast<short>(0xdc00))));
+                }
+            }
+
+            if constexpr (sizeof(char_t) == 1)
+                acc = _mm_sad_epu8(acc, _mm_setzero_si128());
+            else
+                acc = _mm_madd_epi16(acc, _mm_set1_epi16(1));
+
+            alignas(16) std::uint32_t sums[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(sums), acc);
+            count += static_cast<uint_t>(sums[0]) + sums[1] + sums[2] + sums[3];
+        }
+#endif // SUTF_SIMD_SSE2
+
+        for (; it != last; ++it) {
+
+            if constexpr (sizeof(char_t) == 1)
+                count += (static_cast<unit_t<char_t>>(*it) & 0xc0) == 0x80;
+            else
+                count += (static_cast<unit_t<char_t>>(*it) & 0xfc00) == 0xdc00;
+        }
+    }
+
+    return count;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* code_point_skip(const char_t* it, const char_t* last, uint_t count) noexcept
+{
+    // skip the specified number of code points, whole chunks are skipped while they hold no more
+    // code points than remain, code points are counted as units minus continuation units
+
+    if constexpr (sizeof(char_t) == 4) {
+
+        return it + std::min<uint_t>(count, last - it);
+
+    } else {
+
+        constexpr uint_t chunk = 256;
+
+        for (; last - it >= static_cast<int_t>(chunk); it += chunk) {
+
+            const uint_t starts = chunk - continuation_count(it, it + chunk);
+
+            if (starts > count)
+                break;
+
+            count -= starts;
+        }
+
+        // chunk boundary may split code point, so continuation units are skipped
+
+        for (; it != last; ++it) {
+
+            const uint_t unit = static_cast<unit_t<char_t>>(*it);
+            const bool start = sizeof(char_t) == 1 ? (unit & 0xc0) != 0x80 : (unit & 0xfc00) != 0xdc00;
+
+            if (start && count-- == 0)
+                break;
+        }
+
+        return it;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline unit_lengths measure_units(const char_t* it, const char_t* last) noexcept
+{
+    // count code units of several classes in one pass, so that lengths in every encoding follow
+    // from the counts, classes are:
+    // UTF-8 - non ASCII bytes, continuation bytes, leading bytes of 4 byte sequences
+    // UTF-16 - units below 0x80, units below 0x800, surrogates, low surrogates
+    // UTF-32 - units below 0x80, units below 0x800, units below 0x10000
+
+    const uint_t size = last - it;
+    uint_t counts[4] = {};
+
+#if defined(SUTF_SIMD_SSE2)
+    // lanes count matching units and are summed up before they overflow
+
+    constexpr uint_t block = 16 / sizeof(char_t);
+    constexpr uint_t lane_max = sizeof(char_t) == 1 ? 255 : 32767;
+
+    while (last - it >= static_cast<int_t>(block)) {
+
+        __m128i acc[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+
+        for (uint_t index = 0; index != lane_max && last - it >= static_cast<int_t>(block); ++index, it += block) {
+
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+            if constexpr (sizeof(char_t) == 1) {
+
+                const __m128i non_ascii = _mm_cmplt_epi8(units, _mm_setzero_si128());
+                acc[0] = _mm_sub_epi8(acc[0], non_ascii);
+                acc[1] = _mm_sub_epi8(acc[1], _mm_cmplt_epi8(units, _mm_set1_epi8(static_cast<char>(0xc0))));
+                acc[2] = _mm_sub_epi8(acc[2], _mm_and_si128(non_ascii, _mm_cmpgt_epi8(units, _mm_set1_epi8(static_cast<char>(0xef)))));
+
+            } else if constexpr (sizeof(char_t) == 2) {
+
+                const __m128i high = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xf800)));
+                acc[0] = _mm_sub_epi16(acc[0], _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xff80))), _mm_setzero_si128()));
+                acc[1] = _mm_sub_epi16(acc[1], _mm_cmpeq_epi16(high, _mm_setzero_si128()));
+                acc[2] = _mm_sub_epi16(acc[2], _mm_cmpeq_epi16(high, _mm_set1_epi16(static_cast<short>(0xd800))));
+                acc[3] = _mm_sub_epi16(acc[3], _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xfc00))), _mm_set1_epi16(static_cast<short>(0xdc00))));
+
+            } else {
+
+                acc[0] = _mm_sub_epi32(acc[0], _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(~0x7f)), _mm_setzero_si128()));
+                acc[1] = _mm_sub_epi32(acc[1], _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(~0x7ff)), _mm_setzero_si128()));
+                acc[2] = _mm_sub_epi32(acc[2], _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32(~0xffff)), _mm_setzero_si128()));
+            }
+        }
+
+        for (uint_t index = 0; index != 4; ++index) {
+
+            if constexpr (sizeof(char_t) == 1)
+                acc[index] = _mm_sad_epu8(acc[index], _mm_setzero_si128());
+            else if constexpr (sizeof(char_t) == 2)
+                acc[index] = _mm_madd_epi16(acc[index], _mm_set1_epi16(1));
+
+            alignas(16) std::uint32_t sums[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(sums), acc[index]);
+            counts[index] += static_cast<uint_t>(sums[0]) + sums[1] + sums[2] + sums[3];
+        }
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it) {
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*it);
+
+        if constexpr (sizeof(char_t) == 1) {
+
+            counts[0] += unit >> 7;
+            counts[1] += (unit & 0xc0) == 0x80;
+            counts[2] += unit >= 0xf0;
+
+        } else if constexpr (sizeof(char_t) == 2) {
+
+            counts[0] += unit < 0x80;
+            counts[1] += unit < 0x800;
+            counts[2] += (unit & 0xf800) == 0xd800;
+            counts[3] += (unit & 0xfc00) == 0xdc00;
+
+        } else {
+
+            counts[0] += unit < 0x80;
+            counts[1] += unit < 0x800;
+            counts[2] += unit < 0x10000;
+        }
+    }
+
+    // surrogate pair takes 4 bytes in UTF-8, while two 3 byte units are counted for it
+
+    if constexpr (sizeof(char_t) == 1)
+        return { size - counts[1], size, size - counts[1] + counts[2], counts[0] };
+    else if constexpr (sizeof(char_t) == 2)
+        return { size - counts[3], 3 * size - counts[0] - counts[1] - counts[2], size, size - counts[0] };
+    else
+        return { size, 4 * size - counts[0] - counts[1] - counts[2], 2 * size - counts[2], size - counts[0] };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* unit_search(const char_t* it, const char_t* last, const char_t* needle, uint_t size) noexcept
+{
+    // find code unit sequence, candidate positions are filtered by comparing blocks of units with
+    // the first and the last unit of the needle, then the rest of the needle is compared
+
+    if (size == 0)
+        return it;
+
+    if (static_cast<uint_t>(last - it) < size)
+        return last;
+
+    const unit_t<char_t> first_unit = needle[0];
+    const unit_t<char_t> last_unit = needle[size - 1];
+
+    const auto matches = [needle, size](const char_t* candidate) noexcept {
+        return size <= 2 || std::memcmp(candidate + 1, needle + 1, (size - 2) * sizeof(char_t)) == 0;
+    };
+
+#if defined(SUTF_SIMD_AVX2)
+    {
+        constexpr uint_t block = 32 / sizeof(char_t);
+        const __m256i first = sizeof(char_t) == 1 ? _mm256_set1_epi8(static_cast<char>(first_unit)) : sizeof(char_t) == 2 ? _mm256_set1_epi16(static_cast<short>(first_unit)) : _mm256_set1_epi32(static_cast<int>(first_unit));
+        const __m256i back = sizeof(char_t) == 1 ? _mm256_set1_epi8(static_cast<char>(last_unit)) : sizeof(char_t) == 2 ? _mm256_set1_epi16(static_cast<short>(last_unit)) : _mm256_set1_epi32(static_cast<int>(last_unit));
+
+        for (; static_cast<uint_t>(last - it) >= size - 1 + block; it += block) {
+
+            const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+            const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + size - 1));
+            __m256i equal;
+
+            if constexpr (sizeof(char_t) == 1)
+                equal = _mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, back));
+            else if constexpr (sizeof(char_t) == 2)
+                equal = _mm256_and_si256(_mm256_cmpeq_epi16(head, first), _mm256_cmpeq_epi16(tail, back));
+            else
+                equal = _mm256_and_si256(_mm256_cmpeq_epi32(head, first), _mm256_cmpeq_epi32(tail, back));
+
+            for (std::uint32_t mask = _mm256_movemask_epi8(equal); mask != 0; mask &= ~(((std::uint32_t(1) << sizeof(char_t)) - 1) << bit_scan(mask))) {
+
+                const char_t* candidate = it + bit_scan(mask) / sizeof(char_t);
+
+                if (matches(candidate))
+                    return candidate;
+            }
+        }
+    }
+#endif // SUTF_SIMD_AVX2
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+    const __m128i first = sizeof(char_t) == 1 ? _mm_set1_epi8(static_cast<char>(first_unit)) : sizeof(char_t) == 2 ? _mm_set1_epi16(static_cast<short>(first_unit)) : _mm_set1_epi32(static_cast<int>(first_unit));
+    const __m128i back = sizeof(char_t) == 1 ? _mm_set1_epi8(static_cast<char>(last_unit)) : sizeof(char_t) == 2 ? _mm_set1_epi16(static_cast<short>(last_unit)) : _mm_set1_epi32(static_cast<int>(last_unit));
+
+    for (; static_cast<uint_t>(last - it) >= size - 1 + block; it += block) {
+
+        const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + size - 1));
+        __m128i equal;
+
+        if constexpr (sizeof(char_t) == 1)
+            equal = _mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, back));
+        else if constexpr (sizeof(char_t) == 2)
+            equal = _mm_and_si128(_mm_cmpeq_epi16(head, first), _mm_cmpeq_epi16(tail, back));
+        else
+            equal = _mm_and_si128(_mm_cmpeq_epi32(head, first), _mm_cmpeq_epi32(tail, back));
+
+        for (std::uint32_t mask = _mm_movemask_epi8(equal); mask != 0; mask &= ~(((std::uint32_t(1) << sizeof(char_t)) - 1) << bit_scan(mask))) {
+
+            const char_t* candidate = it + bit_scan(mask) / sizeof(char_t);
+
+            if (matches(candidate))
+                return candidate;
+        }
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; static_cast<uint_t>(last - it) >= size; ++it) {
+
+        if (static_cast<unit_t<char_t>>(it[0]) == first_unit && static_cast<unit_t<char_t>>(it[size - 1]) == last_unit && matches(it))
+            return it;
+    }
+
+    return last;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline dst_t* widen(const src_t* it, const src_t* last, dst_t* dst) noexcept
+{
+    static_assert(sizeof(dst_t) > sizeof(src_t));
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(src_t);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; last - it >= static_cast<int_t>(block); it += block, dst += block) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        __m128i* out = reinterpret_cast<__m128i*>(dst);
+
+        if constexpr (sizeof(src_t) == 1 && sizeof(dst_t) == 2) {
+            _mm_storeu_si128(out + 0, _mm_unpacklo_epi8(units, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(units, zero));
+        } else if constexpr (sizeof(src_t) == 1) {
+            const __m128i lo = _mm_unpacklo_epi8(units, zero);
+            const __m128i hi = _mm_unpackhi_epi8(units, zero);
+            _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+        } else {
+            _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(units, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(units, zero));
+        }
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it)
+        *dst++ = static_cast<dst_t>(static_cast<unit_t<src_t>>(*it));
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline dst_t* narrow(const src_t* it, const src_t* last, dst_t* dst) noexcept
+{
+    static_assert(sizeof(dst_t) < sizeof(src_t));
+
+    // every source unit must fit into the destination unit
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 32 / sizeof(src_t);
+
+    for (; last - it >= static_cast<int_t>(block); it += block, dst += block) {
+
+        const __m128i* in = reinterpret_cast<const __m128i*>(it);
+        const __m128i lo = _mm_loadu_si128(in + 0);
+        const __m128i hi = _mm_loadu_si128(in + 1);
+
+        if constexpr (sizeof(src_t) == 2) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(lo, hi));
+        } else if constexpr (sizeof(dst_t) == 2) {
+            // sign extend low halves so that signed saturation keeps the value unchanged
+            const __m128i lo16 = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            const __m128i hi16 = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(lo16, hi16));
+        } else {
+            const __m128i units = _mm_packs_epi32(lo, hi);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(units, units));
+        }
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it)
+        *dst++ = static_cast<dst_t>(static_cast<unit_t<src_t>>(*it));
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline dst_t* copy_units(const src_t* it, const src_t* last, dst_t* dst) noexcept
+{
+    SUTF_INSTRUMENT_KERNEL(simd_tier, last - it);
+
+    if constexpr (sizeof(dst_t) > sizeof(src_t))
+        return widen(it, last, dst);
+    else if constexpr (sizeof(dst_t) < sizeof(src_t))
+        return narrow(it, last, dst);
+    else {
+        if (it != last)
+            std::memcpy(dst, it, (last - it) * sizeof(src_t));
+
+        return dst + (last - it);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline dst_t* unpack_code_points(const src_t* it, const src_t* last, dst_t* dst) noexcept
+{
+    // decode UTF code units to fixed width units, each destination unit must fit code point
+
+    while (it != last) {
+
+        const src_t* ascii = ascii_end(it, last);
+
+        dst = copy_units(it, ascii, dst);
+        it = ascii;
+
+        while (it != last && static_cast<unit_t<src_t>>(*it) >= 0x80) {
+
+            SUTF_INSTRUMENT_KERNEL(kernel_tier::scalar, code_point_next(it) - it);
+
+            *dst++ = static_cast<dst_t>(code_point_read(it));
+            it = code_point_next(it);
+        }
+    }
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline dst_t* pack_code_points(const src_t* it, const src_t* last, dst_t* dst) noexcept
+{
+    // encode fixed width units, each holding a whole code point, to UTF code units
+
+    while (it != last) {
+
+        const src_t* ascii = ascii_end(it, last);
+
+        dst = copy_units(it, ascii, dst);
+        it = ascii;
+
+        for (; it != last && static_cast<unit_t<src_t>>(*it) >= 0x80; ++it) {
+
+            SUTF_INSTRUMENT_KERNEL(kernel_tier::scalar, 1);
+
+            dst = code_point_write(dst, static_cast<unit_t<src_t>>(*it));
+        }
+    }
+
+    return dst;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+inline dst_t* transcode(const src_t* it, const src_t* last, dst_t* dst) noexcept
+{
+    // convert UTF code units to UTF code units of another width, runs of ASCII are copied in bulk,
+    // the rest is converted code point by code point, code point truncated by the end of source
+    // is replaced with U+FFFD
+
+    if constexpr (sizeof(dst_t) == sizeof(src_t))
+        return copy_units(it, last, dst);
+    else if constexpr (sizeof(src_t) == 4)
+        return pack_code_points(it, last, dst);
+    else {
+
+        while (it != last) {
+
+            const src_t* ascii = ascii_end(it, last);
+
+            dst = copy_units(it, ascii, dst);
+            it = ascii;
+
+            while (it != last && static_cast<unit_t<src_t>>(*it) >= 0x80) {
+
+                const src_t* next = code_point_next(it);
+
+                if (next > last)
+                    return code_point_write(dst, 0xfffd);
+
+                SUTF_INSTRUMENT_KERNEL(kernel_tier::scalar, next - it);
+
+                dst = code_point_write(dst, code_point_read(it));
+                it = next;
+            }
+        }
+
+        return dst;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename dst_t, typename src_t>
+constexpr uint_t max_code_units(uint_t size) noexcept
+{
+    // upper bound of dst_t code units occupied by size src_t code units
+
+    if constexpr (sizeof(dst_t) == 1)
+        return size * (sizeof(src_t) == 1 ? 1 : sizeof(src_t) == 2 ? 3 : 4);
+    else if constexpr (sizeof(dst_t) == 2)
+        return size * (sizeof(src_t) == 4 ? 2 : 1);
+    else
+        return size;
+}
+
+} // namespace impl
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_simd.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,373 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_algorithm.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// stable sort of UTF-8, UTF-16 or UTF-32 strings in code point order by MSD radix sort, elements
+// are any contiguous strings or string views, zero number of threads means hardware concurrency
+
+template<typename it_t>
+void sort_strings(it_t first, it_t last, uint_t threads = 0);
+template<typename range_t>
+auto sort_strings(range_t& strings, uint_t threads = 0) -> decltype(std::begin(strings), void());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// MSD radix sort of string references by bytes of keys of code units from the most significant
+// one, the sort is stable, buckets over the threshold are sorted by concurrent workers, every
+// reference caches 8 bytes of the key, so that strings are read once per 8 passes
+
+template<typename char_t>
+class radix_sorter
+{
+public:
+    struct entry
+    {
+        const char_t* data;
+        uint_t size;
+        uint_t index;
+        std::uint64_t key;
+    };
+
+    static constexpr uint_t insertion_threshold = 32;
+    static constexpr uint_t parallel_threshold = 1 << 14;
+
+public:
+    radix_sorter(entry* entries, uint_t count, uint_t threads)
+        : m_entries(entries)
+        , m_temp(count)
+        , m_threads(threads)
+    {
+        m_tasks.reserve(count / parallel_threshold + 1);
+        m_tasks.push_back({ 0, count, 0 });
+        m_pending = 1;
+    }
+
+    void run()
+    {
+        // the sort continues with fewer workers when a thread can't be started, the started ones
+        // and the calling thread complete all tasks
+
+        std::vector<std::thread> workers;
+        workers.reserve(std::max<uint_t>(m_threads, 1) - 1);
+
+        try {
+
+            for (uint_t index = 1; index < m_threads; ++index)
+                workers.emplace_back([this] { work(); });
+
+        } catch (const std::system_error&) {
+        }
+
+        work();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+private:
+    struct task
+    {
+        uint_t first;
+        uint_t count;
+        uint_t depth;
+    };
+
+    static std::uint64_t load_key(const entry& item, uint_t depth) noexcept
+    {
+        // big endian keys of units of 8 bytes window starting at depth
+
+        constexpr uint_t units = 8 / sizeof(char_t);
+        const uint_t position = depth / sizeof(char_t);
+        std::uint64_t key = 0;
+
+        for (uint_t index = position; index < item.size && index != position + units; ++index)
+            key |= std::uint64_t(code_point_order<char_t>(static_cast<unit_t<char_t>>(item.data[index]))) << ((units - 1 - (index - position)) * sizeof(char_t) * 8);
+
+        return key;
+    }
+
+    static uint_t digit(const entry& item, uint_t depth) noexcept
+    {
+        // byte of key at depth plus one, zero for ended string
+
+        if (depth / sizeof(char_t) >= item.size)
+            return 0;
+
+        return ((item.key >> ((7 - depth % 8) * 8)) & 0xff) + 1;
+    }
+
+    static bool less(const entry& lhs, const entry& rhs, uint_t depth) noexcept
+    {
+        // units before depth are equal, cached keys are padded by zeros after the end of string,
+        // so that they are compared first and the strings are read only if the keys are equal
+
+        if (lhs.key != rhs.key)
+            return lhs.key < rhs.key;
+
+        const uint_t size = std::min(lhs.size, rhs.size);
+
+        for (uint_t position = (depth & ~uint_t(7)) / sizeof(char_t) + 8 / sizeof(char_t); position < size; ++position) {
+
+            const uint_t lhs_key = code_point_order<char_t>(static_cast<unit_t<char_t>>(lhs.data[position]));
+            const uint_t rhs_key = code_point_order<char_t>(static_cast<unit_t<char_t>>(rhs.data[position]));
+
+            if (lhs_key != rhs_key)
+                return lhs_key < rhs_key;
+        }
+
+        return lhs.size < rhs.size;
+    }
+
+    void insertion_sort(entry* first, uint_t count, uint_t depth) noexcept
+    {
+        for (uint_t index = 1; index < count; ++index) {
+
+            const entry item = first[index];
+            uint_t position = index;
+
+            for (; position != 0 && less(item, first[position - 1], depth); --position)
+                first[position] = first[position - 1];
+
+            first[position] = item;
+        }
+    }
+
+    void work()
+    {
+        for (;;) {
+
+            std::unique_lock lock(m_mutex);
+            m_changed.wait(lock, [this] { return !m_tasks.empty() || m_pending == 0; });
+
+            if (m_tasks.empty())
+                return;
+
+            const task item = m_tasks.back();
+            m_tasks.pop_back();
+            lock.unlock();
+
+            sort(item.first, item.count, item.depth, true);
+
+            lock.lock();
+
+            if (--m_pending == 0)
+                m_changed.notify_all();
+        }
+    }
+
+    void sort(uint_t first, uint_t count, uint_t depth, bool shared)
+    {
+        // the largest bucket is sorted in the loop and the other ones recursively, so that
+        // the recursion depth is logarithmic, large buckets are shared with other workers
+
+        for (;;) {
+
+            entry* const entries = m_entries + first;
+
+            if (depth % 8 == 0) {
+                for (uint_t index = 0; index != count; ++index)
+                    entries[index].key = load_key(entries[index], depth);
+            }
+
+            if (count <= insertion_threshold) {
+
+                insertion_sort(entries, count, depth);
+                return;
+            }
+
+            entry* const temp = m_temp.data() + first;
+            uint_t offsets[258] = {};
+
+            for (uint_t index = 0; index != count; ++index)
+                ++offsets[digit(entries[index], depth) + 1];
+
+            // common byte, such as high byte of ASCII in UTF-16, doesn't need to be scattered
+
+            const uint_t common = digit(entries[0], depth);
+
+            if (offsets[common + 1] == count) {
+
+                if (common == 0)
+                    return;
+
+                ++depth;
+                continue;
+            }
+
+            for (uint_t index = 1; index != 258; ++index)
+                offsets[index] += offsets[index - 1];
+
+            for (uint_t index = 0; index != count; ++index)
+                temp[offsets[digit(entries[index], depth)]++] = entries[index];
+
+            std::copy(temp, temp + count, entries);
+
+            // offsets are ends of buckets now, ended strings are equal and stay in order
+
+            uint_t largest = 1;
+
+            for (uint_t index = 2; index != 257; ++index) {
+                if (offsets[index] - offsets[index - 1] > offsets[largest] - offsets[largest - 1])
+                    largest = index;
+            }
+
+            for (uint_t index = 1; index != 257; ++index) {
+
+                const uint_t bucket_count = offsets[index] - offsets[index - 1];
+
+                if (index == largest || bucket_count < 2)
+                    continue;
+
+                if (shared && bucket_count >= parallel_threshold && m_threads > 1)
+                    share({ first + offsets[index - 1], bucket_count, depth + 1 });
+                else
+                    sort(first + offsets[index - 1], bucket_count, depth + 1, false);
+            }
+
+            first += offsets[largest - 1];
+            count = offsets[largest] - offsets[largest - 1];
+            ++depth;
+        }
+    }
+
+    void share(const task& item)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        m_tasks.push_back(item);
+        ++m_pending;
+        m_changed.notify_one();
+    }
+
+private:
+    entry* m_entries;
+    std::vector<entry> m_temp;
+    uint_t m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<task> m_tasks;
+    uint_t m_pending = 0;
+};
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename it_t>
+inline void sort_strings(it_t first, it_t last, uint_t threads)
+{
+    // strings are sorted by references and then moved to their places along permutation cycles
+
+    using char_t = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(*first))>>;
+    using entry = typename impl::radix_sorter<char_t>::entry;
+
+    const uint_t count = last - first;
+
+    if (count < 2)
+        return;
+
+    std::vector<entry> entries(count);
+
+    for (uint_t index = 0; index != count; ++index)
+        entries[index] = { std::data(first[index]), static_cast<uint_t>(std::size(first[index])), index, 0 };
+
+    if (threads == 0)
+        threads = std::max<uint_t>(std::thread::hardware_concurrency(), 1);
+
+    threads = std::min<uint_t>(threads, count / impl::radix_sorter<char_t>::parallel_threshold + 1);
+
+    impl::radix_sorter<char_t>(entries.data(), count, threads).run();
+
+    for (uint_t index = 0; index != count; ++index) {
+
+        if (entries[index].index == index)
+            continue;
+
+        auto item = std::move(first[index]);
+        uint_t position = index;
+
+        while (entries[position].index != index) {
+
+            const uint_t source = entries[position].index;
+
+            first[position] = std::move(first[source]);
+            entries[position].index = position;
+            position = source;
+        }
+
+        first[position] = std::move(item);
+        entries[position].index = position;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename range_t>
+inline auto sort_strings(range_t& strings, uint_t threads) -> decltype(std::begin(strings), void())
+{
+    sort_strings(std::begin(strings), std::end(strings), threads);
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_sort.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,547 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "utf_property.h"
+
+#include <stdexcept>
+
+namespace sutf
+{
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// set of delimiter code points, either Unicode whitespace or up to 16 ASCII and 16 other code
+// points
+
+struct delimiter_set
+{
+    static constexpr uint_t capacity = 16;
+
+    bool whitespace = false;
+    uint_t ascii_count = 0;
+    uint_t other_count = 0;
+    char ascii[capacity] = {};
+    char32_t others[capacity] = {};
+};
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// split_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// forward iterator over tokens of contiguous string, tokens are views of the string, the iterator
+// refers to delimiters of the range which created it
+
+template<typename char_t>
+class split_iterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::basic_string_view<char_t>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = value_type;
+
+public:
+    split_iterator() noexcept = default;
+    split_iterator(const char_t* it, const char_t* last, const impl::delimiter_set* delimiters) noexcept;
+
+    value_type operator*() const noexcept;
+    split_iterator& operator++() noexcept;
+    split_iterator operator++(int) noexcept;
+
+    bool operator==(const split_iterator& other) const noexcept;
+    bool operator!=(const split_iterator& other) const noexcept;
+
+private:
+    void find_token() noexcept;
+
+private:
+    const char_t* m_token = nullptr;
+    const char_t* m_token_end = nullptr;
+    const char_t* m_next = nullptr;
+    const char_t* m_last = nullptr;
+    const impl::delimiter_set* m_delimiters = nullptr;
+    bool m_last_token = false;
+    bool m_end = true;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// split_range
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// range of tokens for range based for loops
+
+template<typename char_t>
+class split_range
+{
+public:
+    split_range() noexcept = default;
+    split_range(const char_t* it, const char_t* last, const impl::delimiter_set& delimiters) noexcept;
+
+    split_iterator<char_t> begin() const noexcept;
+    split_iterator<char_t> end() const noexcept;
+
+private:
+    const char_t* m_it = nullptr;
+    const char_t* m_last = nullptr;
+    impl::delimiter_set m_delimiters;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// split contiguous string without allocation, the first form splits on runs of Unicode whitespace
+// and skips empty tokens, the second one splits on every code point of delimiters string and
+// keeps empty tokens, more than 16 ASCII or 16 other delimiters throw std::invalid_argument
+
+template<typename type_t>
+auto split(const type_t& str) noexcept -> split_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>;
+template<typename type_t, typename delimiters_t>
+auto split(const type_t& str, const delimiters_t& delimiters) -> decltype(std::cbegin(delimiters), split_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>());
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+#if defined(SUTF_SIMD_SSE2)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline __m128i simd_equal(__m128i units, uint_t value) noexcept
+{
+    if constexpr (sizeof(char_t) == 1)
+        return _mm_cmpeq_epi8(units, _mm_set1_epi8(static_cast<char>(value)));
+    else if constexpr (sizeof(char_t) == 2)
+        return _mm_cmpeq_epi16(units, _mm_set1_epi16(static_cast<short>(value)));
+    else
+        return _mm_cmpeq_epi32(units, _mm_set1_epi32(static_cast<int>(value)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline __m128i simd_in_range(__m128i units, uint_t first, uint_t last) noexcept
+{
+    // unsigned comparison of units shifted by the first value of range
+
+    if constexpr (sizeof(char_t) == 1) {
+
+        const __m128i shifted = _mm_sub_epi8(units, _mm_set1_epi8(static_cast<char>(first)));
+        return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(static_cast<char>(last - first))), shifted);
+
+    } else if constexpr (sizeof(char_t) == 2) {
+
+        const __m128i shifted = _mm_sub_epi16(units, _mm_set1_epi16(static_cast<short>(first)));
+        return _mm_cmpeq_epi16(_mm_subs_epu16(shifted, _mm_set1_epi16(static_cast<short>(last - first))), _mm_setzero_si128());
+
+    } else {
+
+        const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000));
+        const __m128i shifted = _mm_sub_epi32(units, _mm_set1_epi32(static_cast<int>(first)));
+        return _mm_cmplt_epi32(_mm_xor_si128(shifted, sign), _mm_set1_epi32(static_cast<int>((last - first + 1) ^ 0x80000000)));
+    }
+}
+#endif // SUTF_SIMD_SSE2
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool is_delimiter_candidate(uint_t unit, const delimiter_set& delimiters) noexcept
+{
+    // ASCII candidates are delimiters, the other ones have to be decoded and checked
+
+    if (delimiters.whitespace) {
+
+        if (unit == ' ' || unit - '\t' < 5)
+            return true;
+
+        // UTF-8 lead bytes of non-ASCII whitespace
+
+        if constexpr (sizeof(char_t) == 1)
+            return unit == 0xc2 || unit - 0xe1 < 3;
+        else
+            return unit >= 0x80;
+    }
+
+    for (uint_t index = 0; index != delimiters.ascii_count; ++index) {
+        if (unit == static_cast<uint_t>(delimiters.ascii[index]))
+            return true;
+    }
+
+    return delimiters.other_count != 0 && unit >= 0x80;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* delimiter_candidate(const char_t* it, const char_t* last, const delimiter_set& delimiters) noexcept
+{
+    // find ASCII delimiters and code units which may start non-ASCII delimiters by SIMD
+
+#if defined(SUTF_SIMD_SSE2)
+    constexpr uint_t block = 16 / sizeof(char_t);
+
+    for (; last - it >= static_cast<int_t>(block); it += block) {
+
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        __m128i candidates;
+
+        if (delimiters.whitespace) {
+
+            candidates = _mm_or_si128(simd_equal<char_t>(units, ' '), simd_in_range<char_t>(units, '\t', '\r'));
+
+            if constexpr (sizeof(char_t) == 1)
+                candidates = _mm_or_si128(candidates, _mm_or_si128(simd_equal<char_t>(units, 0xc2), simd_in_range<char_t>(units, 0xe1, 0xe3)));
+            else
+                candidates = _mm_or_si128(candidates, _mm_xor_si128(simd_in_range<char_t>(units, 0, 0x7f), _mm_set1_epi8(-1)));
+
+        } else {
+
+            candidates = _mm_setzero_si128();
+
+            for (uint_t index = 0; index != delimiters.ascii_count; ++index)
+                candidates = _mm_or_si128(candidates, simd_equal<char_t>(units, delimiters.ascii[index]));
+
+            if (delimiters.other_count != 0)
+                candidates = _mm_or_si128(candidates, _mm_xor_si128(simd_in_range<char_t>(units, 0, 0x7f), _mm_set1_epi8(-1)));
+        }
+
+        const std::uint32_t mask = _mm_movemask_epi8(candidates);
+
+        if (mask != 0)
+            return it + bit_scan(mask) / sizeof(char_t);
+    }
+#endif // SUTF_SIMD_SSE2
+
+    for (; it != last; ++it) {
+        if (is_delimiter_candidate<char_t>(static_cast<unit_t<char_t>>(*it), delimiters))
+            break;
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool is_delimiter(uint_t cp, const delimiter_set& delimiters) noexcept
+{
+    if (delimiters.whitespace)
+        return is_whitespace(cp);
+
+    if (cp < 0x80)
+        return std::find(delimiters.ascii, delimiters.ascii + delimiters.ascii_count, static_cast<char>(cp)) != delimiters.ascii + delimiters.ascii_count;
+
+    return std::find(delimiters.others, delimiters.others + delimiters.other_count, static_cast<char32_t>(cp)) != delimiters.others + delimiters.other_count;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* delimiter_find(const char_t* it, const char_t* last, const delimiter_set& delimiters, const char_t*& delimiter_end) noexcept
+{
+    // start and end of the first delimiter, candidates are decoded only around non-ASCII units
+
+    while ((it = delimiter_candidate(it, last, delimiters)) != last) {
+
+        if (static_cast<unit_t<char_t>>(*it) < 0x80) {
+
+            delimiter_end = it + 1;
+            return it;
+        }
+
+        const char_t* next = code_point_next(it);
+
+        if (next > last)
+            break;
+
+        if (is_delimiter(code_point_read(it), delimiters)) {
+
+            delimiter_end = next;
+            return it;
+        }
+
+        it = next;
+    }
+
+    delimiter_end = last;
+    return last;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* delimiter_skip(const char_t* it, const char_t* last, const delimiter_set& delimiters) noexcept
+{
+    // skip run of delimiters, ASCII units are delimiters only if they are candidates
+
+    while (it != last) {
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*it);
+
+        if (unit < 0x80) {
+
+            if (!is_delimiter_candidate<char_t>(unit, delimiters))
+                break;
+
+            ++it;
+            continue;
+        }
+
+        const char_t* next = code_point_next(it);
+
+        if (next > last || !is_delimiter(code_point_read(it), delimiters))
+            break;
+
+        it = next;
+    }
+
+    return it;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline delimiter_set make_delimiter_set(const type_t& delimiters)
+{
+    delimiter_set result;
+
+    const auto [first, last] = code_units_of(delimiters);
+
+    for (auto it = first; last - it > 0; it = code_point_next(it)) {
+
+        const uint_t cp = code_point_read(it);
+
+        if (cp < 0x80 && result.ascii_count != delimiter_set::capacity)
+            result.ascii[result.ascii_count++] = static_cast<char>(cp);
+        else if (cp >= 0x80 && result.other_count != delimiter_set::capacity)
+            result.others[result.other_count++] = static_cast<char32_t>(cp);
+        else
+            throw std::invalid_argument("Too many delimiters.");
+    }
+
+    return result;
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// split_iterator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline split_iterator<char_t>::split_iterator(const char_t* it, const char_t* last, const impl::delimiter_set* delimiters) noexcept
+    : m_next(it)
+    , m_last(last)
+    , m_delimiters(delimiters)
+    , m_end(false)
+{
+    find_token();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline typename split_iterator<char_t>::value_type split_iterator<char_t>::operator*() const noexcept
+{
+    return value_type(m_token, m_token_end - m_token);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline split_iterator<char_t>& split_iterator<char_t>::operator++() noexcept
+{
+    find_token();
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline split_iterator<char_t> split_iterator<char_t>::operator++(int) noexcept
+{
+    split_iterator result = *this;
+    ++*this;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool split_iterator<char_t>::operator==(const split_iterator& other) const noexcept
+{
+    return m_end == other.m_end && (m_end || m_token == other.m_token);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline bool split_iterator<char_t>::operator!=(const split_iterator& other) const noexcept
+{
+    return !(*this == other);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline void split_iterator<char_t>::find_token() noexcept
+{
+    // the token starts at the next position, the end state doesn't depend on pointers, so that
+    // empty strings without data are split as the other ones, whitespace runs are skipped as one
+    // delimiter
+
+    if (m_last_token) {
+
+        m_end = true;
+        return;
+    }
+
+    m_token = m_next;
+
+    if (m_delimiters->whitespace) {
+
+        m_token = impl::delimiter_skip(m_token, m_last, *m_delimiters);
+
+        if (m_token == m_last) {
+
+            m_end = true;
+            return;
+        }
+    }
+
+    const char_t* delimiter_end;
+    m_token_end = impl::delimiter_find(m_token, m_last, *m_delimiters, delimiter_end);
+    m_last_token = m_token_end == m_last;
+    m_next = m_last_token ? m_last : delimiter_end;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// split_range
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename char_t>
+inline split_range<char_t>::split_range(const char_t* it, const char_t* last, const impl::delimiter_set& delimiters) noexcept
+    : m_it(it)
+    , m_last(last)
+    , m_delimiters(delimiters)
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline split_iterator<char_t> split_range<char_t>::begin() const noexcept
+{
+    return split_iterator<char_t>(m_it, m_last, &m_delimiters);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline split_iterator<char_t> split_range<char_t>::end() const noexcept
+{
+    return split_iterator<char_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+inline auto split(const type_t& str) noexcept -> split_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be split.");
+
+    const auto [first, last] = impl::code_units_of(str);
+    impl::delimiter_set delimiters;
+    delimiters.whitespace = true;
+
+    return split_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>(first, last, delimiters);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename delimiters_t>
+inline auto split(const type_t& str, const delimiters_t& delimiters) -> decltype(std::cbegin(delimiters), split_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>())
+{
+    static_assert(impl::is_contiguous_string_v<type_t> || is_char_array_v<type_t>, "Only contiguous strings can be split.");
+
+    const auto [first, last] = impl::code_units_of(str);
+
+    return split_range<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(str))>>>(first, last, impl::make_delimiter_set(delimiters));
+}
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_split.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "utf_string.h"
+#include "utf_simd.h"
+
+#include <algorithm>
+#include <streambuf>
+#include <vector>
+
+namespace sutf
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// transcoding_streambuf
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stream buffer adapter which converts code units of the underlying stream buffer of one encoding
+// to code units of another encoding on input and back on output, the data is converted in blocks,
+// code points split by block boundaries are carried over to the next block, incomplete code
+// point at the end of input or output is converted to U+FFFD
+
+template<typename charsrc_t, typename chardst_t>
+class transcoding_streambuf : public std::basic_streambuf<chardst_t>
+{
+public:
+    using source_type = std::basic_streambuf<charsrc_t>;
+    using char_type = chardst_t;
+    using traits_type = typename std::basic_streambuf<chardst_t>::traits_type;
+    using int_type = typename traits_type::int_type;
+
+public:
+    explicit transcoding_streambuf(source_type* source, uint_t block_size = 65536);
+    transcoding_streambuf(const transcoding_streambuf&) = delete;
+    transcoding_streambuf& operator=(const transcoding_streambuf&) = delete;
+    ~transcoding_streambuf() override;
+
+    source_type* source() const noexcept;
+
+protected:
+    int_type underflow() override;
+    int_type overflow(int_type ch) override;
+    int sync() override;
+
+private:
+    bool flush(bool final);
+
+private:
+    source_type* m_source;
+    std::vector<charsrc_t> m_input;
+    std::vector<chardst_t> m_get;
+    std::vector<chardst_t> m_put;
+    std::vector<charsrc_t> m_output;
+    uint_t m_carry = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+template<typename char_t>
+inline const char_t* complete_end(const char_t* it, const char_t* last) noexcept;
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// transcoding_streambuf
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename charsrc_t, typename chardst_t>
+inline transcoding_streambuf<charsrc_t, chardst_t>::transcoding_streambuf(source_type* source, uint_t block_size)
+    : m_source(source)
+{
+    static_assert(is_any_char_v<charsrc_t> && is_any_char_v<chardst_t>);
+
+    if (!source)
+        throw std::invalid_argument("Source stream buffer is not specified.");
+
+    // block must fit on the longest code point to make progress
+
+    block_size = std::max<uint_t>(block_size, 4);
+
+    m_input.resize(block_size);
+    m_get.resize(impl::max_code_units<chardst_t, charsrc_t>(block_size));
+    m_put.resize(block_size);
+    m_output.resize(impl::max_code_units<charsrc_t, chardst_t>(block_size));
+
+    this->setp(m_put.data(), m_put.data() + m_put.size());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline transcoding_streambuf<charsrc_t, chardst_t>::~transcoding_streambuf()
+{
+    if (flush(true))
+        m_source->pubsync();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline typename transcoding_streambuf<charsrc_t, chardst_t>::source_type* transcoding_streambuf<charsrc_t, chardst_t>::source() const noexcept
+{
+    return m_source;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline typename transcoding_streambuf<charsrc_t, chardst_t>::int_type transcoding_streambuf<charsrc_t, chardst_t>::underflow()
+{
+    if (this->gptr() < this->egptr())
+        return traits_type::to_int_type(*this->gptr());
+
+    chardst_t* out = m_get.data();
+
+    while (out == m_get.data()) {
+
+        // append the next block to units of code point carried over from the previous block
+
+        const uint_t count = static_cast<uint_t>(std::max<std::streamsize>(m_source->sgetn(m_input.data() + m_carry, m_input.size() - m_carry), 0));
+        const charsrc_t* first = m_input.data();
+        const charsrc_t* last = first + m_carry + count;
+
+        if (first == last)
+            return traits_type::eof();
+
+        // incomplete code point at the end of input is converted to U+FFFD
+
+        const charsrc_t* end = count == 0 ? last : impl::complete_end(first, last);
+        out = impl::transcode(first, end, out);
+
+        m_carry = last - end;
+        std::copy(end, last, m_input.data());
+    }
+
+    this->setg(m_get.data(), m_get.data(), out);
+
+    return traits_type::to_int_type(*this->gptr());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline typename transcoding_streambuf<charsrc_t, chardst_t>::int_type transcoding_streambuf<charsrc_t, chardst_t>::overflow(int_type ch)
+{
+    if (!flush(false))
+        return traits_type::eof();
+
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+        return traits_type::not_eof(ch);
+
+    *this->pptr() = traits_type::to_char_type(ch);
+    this->pbump(1);
+
+    return ch;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline int transcoding_streambuf<charsrc_t, chardst_t>::sync()
+{
+    return flush(false) && m_source->pubsync() != -1 ? 0 : -1;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename charsrc_t, typename chardst_t>
+inline bool transcoding_streambuf<charsrc_t, chardst_t>::flush(bool final)
+{
+    // write complete code points of the put area, incomplete one is moved to the beginning of
+    // the put area unless it's the final flush
+
+    const chardst_t* first = this->pbase();
+    const chardst_t* last = this->pptr();
+    const chardst_t* end = final ? last : impl::complete_end(first, last);
+    const charsrc_t* out = impl::transcode(first, end, m_output.data());
+    const std::streamsize size = out - m_output.data();
+
+    if (size != 0 && m_source->sputn(m_output.data(), size) != size)
+        return false;
+
+    const uint_t carry = last - end;
+
+    std::copy(end, last, m_put.data());
+    this->setp(m_put.data(), m_put.data() + m_put.size());
+    this->pbump(static_cast<int>(carry));
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// implementation stuff
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t>
+inline const char_t* complete_end(const char_t* it, const char_t* last) noexcept
+{
+    // end of the last complete code point, invalid sequences are considered complete
+
+    if constexpr (sizeof(char_t) == 1) {
+
+        const char_t* lead = last;
+
+        while (lead != it && last - lead < 3 && (static_cast<unit_t<char_t>>(lead[-1]) & 0xc0) == 0x80)
+            --lead;
+
+        if (lead == it)
+            return last;
+
+        const uint_t unit = static_cast<unit_t<char_t>>(*--lead);
+        const int_t size = unit >= 0xf0 ? 4 : unit >= 0xe0 ? 3 : unit >= 0xc0 ? 2 : 1;
+
+        return last - lead < size ? lead : last;
+
+    } else if constexpr (sizeof(char_t) == 2) {
+
+        if (it != last && (static_cast<unit_t<char_t>>(last[-1]) & 0xfc00) == 0xd800)
+            return last - 1;
+
+        return last;
+
+    } else {
+
+        return last;
+    }
+}
+
+} // namespace impl
+
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_stream.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "utf_codepoint.h"
+#include "utf_instrument.h"
 
 #include <stdexcept>
 #include <string>
@@ -589,11 +590,15 @@ inline std::basic_string<chardst_t> to_anystring(const std::basic_string_view<ch
 template<typename char_t, typename it_t, std::enable_if_t<is_any_const_iterator_v<it_t>, int>>
 inline std::basic_string<char_t> to_anystring(it_t str, it_t last)
 {
+    SUTF_INSTRUMENT_CONVERSION(char_t, str, last);
+
     std::basic_string<char_t> out;
     out.resize(code_unit_count<char_t>(str, last));
 
     code_point_convert(str, last, out.begin());
 
+    SUTF_INSTRUMENT_RESULT(out.size());
+
     return out;
 }
 
@@ -666,8 +671,12 @@ inline auto convert(const std::basic_string_view<char_t>& src, type_t& dst) -> d
     if (std::size(dst) < dst_size)
         throw std::length_error("Destination buffer doesn't fit on the specified string after convertion.");
 
+    SUTF_INSTRUMENT_CONVERSION(chardst_t, src.cbegin(), src.cend());
+
     code_point_convert(src.cbegin(), src.cend(), std::begin(dst));
 
+    SUTF_INSTRUMENT_RESULT(dst_size);
+
     return dst_size;
 }
 
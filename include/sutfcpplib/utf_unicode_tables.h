@@ -0,0 +1,3241 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// generated by tools/unicode_tables.py from Unicode Character Database 14.0.0, don't edit
+
+#pragma once
+
+#include "utf_codepoint.h"
+
+namespace sutf
+{
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// general category in bits 0-4, white space in bit 5, 19200 bytes
+
+inline constexpr std::uint8_t property_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 26, 29, 30, 31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 34, 34,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    26, 56, 57, 58, 58, 58, 58, 59, 26, 26, 60, 58, 58, 58, 58, 58,
+    58, 58, 26, 61, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 26, 62, 58, 63, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 64, 26, 26, 65, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 66, 67, 68, 58, 58, 58, 58, 69, 58,
+    58, 58, 58, 58, 58, 58, 58, 70, 71, 72, 73, 74, 75, 76, 58, 77,
+    78, 79, 58, 80, 81, 58, 82, 83, 84, 85, 75, 86, 87, 88, 58, 58,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 89, 26, 26, 26, 26, 26, 26, 26, 90, 91, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 92, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 93, 58, 58, 58, 58, 58, 58, 26, 94, 58, 58,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 95, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    96, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 97,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 97,
+};
+
+inline constexpr std::uint16_t property_stage2[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+    15, 15, 15, 16, 17, 15, 15, 18, 19, 20, 21, 22, 23, 24, 15, 25,
+    15, 15, 15, 26, 27, 13, 13, 13, 13, 28, 13, 29, 30, 31, 32, 33,
+    34, 34, 34, 34, 34, 34, 34, 35, 36, 37, 38, 13, 39, 40, 15, 41,
+    11, 11, 11, 13, 13, 13, 15, 15, 42, 15, 15, 15, 43, 15, 15, 15,
+    15, 15, 15, 44, 11, 45, 13, 13, 46, 47, 34, 48, 49, 50, 51, 52,
+    53, 54, 50, 50, 55, 34, 56, 57, 50, 50, 50, 50, 50, 58, 59, 60,
+    61, 62, 50, 34, 63, 50, 50, 50, 50, 50, 64, 65, 66, 50, 67, 68,
+    50, 69, 70, 71, 50, 72, 73, 50, 74, 75, 50, 50, 76, 34, 77, 34,
+    78, 50, 50, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+    92, 85, 86, 93, 94, 95, 96, 97, 98, 99, 86, 100, 101, 102, 90, 103,
+    104, 85, 86, 105, 106, 107, 90, 108, 109, 110, 111, 112, 113, 114, 96, 115,
+    116, 117, 86, 118, 119, 120, 90, 121, 122, 117, 86, 123, 124, 125, 90, 126,
+    127, 117, 50, 128, 129, 130, 90, 131, 132, 133, 50, 134, 135, 136, 96, 137,
+    138, 50, 50, 139, 140, 141, 142, 142, 143, 50, 144, 145, 146, 147, 142, 142,
+    148, 149, 150, 151, 152, 50, 153, 154, 155, 156, 34, 157, 158, 159, 142, 142,
+    50, 50, 160, 161, 162, 163, 164, 165, 166, 167, 11, 11, 168, 13, 13, 169,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 170, 171, 50, 50, 170, 50, 50, 172, 173, 174, 50, 50,
+    50, 173, 50, 50, 50, 175, 176, 177, 50, 178, 11, 11, 11, 11, 11, 179,
+    180, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 181, 50, 182, 183, 50, 50, 50, 50, 184, 185,
+    50, 186, 50, 187, 50, 188, 189, 190, 50, 50, 50, 191, 192, 193, 194, 195,
+    196, 194, 50, 50, 197, 50, 50, 198, 199, 50, 200, 50, 50, 50, 50, 201,
+    50, 202, 203, 204, 205, 50, 206, 207, 50, 50, 208, 50, 209, 210, 211, 211,
+    50, 212, 50, 50, 50, 213, 214, 215, 194, 194, 216, 217, 218, 142, 142, 142,
+    219, 50, 50, 220, 221, 162, 222, 223, 224, 50, 225, 66, 50, 50, 226, 227,
+    50, 50, 228, 229, 230, 66, 50, 231, 232, 11, 11, 233, 234, 235, 236, 237,
+    13, 13, 238, 29, 29, 29, 239, 240, 13, 241, 29, 29, 34, 34, 34, 34,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 242, 15, 15, 15, 15, 15, 15,
+    243, 244, 243, 243, 244, 245, 243, 246, 247, 247, 247, 248, 249, 250, 251, 252,
+    253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 274, 275, 276, 277, 211, 278, 279, 211, 280,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+    282, 211, 283, 211, 211, 211, 211, 284, 211, 285, 281, 286, 211, 287, 288, 211,
+    211, 211, 289, 142, 290, 142, 273, 273, 273, 291, 211, 211, 211, 211, 292, 273,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 293, 294, 211, 211, 295,
+    211, 211, 211, 211, 211, 211, 296, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 297, 298, 273, 299, 211, 211, 300, 281, 301, 281,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    281, 281, 281, 281, 281, 281, 281, 281, 302, 303, 281, 281, 281, 304, 281, 305,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+    211, 211, 211, 281, 306, 211, 211, 307, 211, 308, 211, 211, 211, 211, 211, 211,
+    11, 11, 11, 13, 13, 13, 309, 310, 15, 15, 15, 15, 15, 15, 311, 312,
+    13, 13, 313, 50, 50, 50, 314, 315, 50, 316, 317, 317, 317, 317, 34, 34,
+    318, 319, 320, 321, 322, 323, 142, 142, 211, 324, 211, 211, 211, 211, 211, 325,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 326, 142, 327,
+    328, 329, 330, 331, 138, 50, 50, 50, 50, 332, 180, 50, 50, 50, 50, 333,
+    334, 50, 50, 138, 50, 50, 50, 50, 202, 335, 50, 50, 211, 211, 325, 50,
+    211, 336, 337, 211, 338, 339, 211, 211, 337, 211, 211, 339, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 211, 211, 211, 211,
+    50, 340, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 153, 211, 211, 211, 289, 50, 50, 231,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    341, 50, 342, 142, 15, 15, 343, 344, 15, 345, 50, 50, 50, 50, 346, 347,
+    33, 348, 349, 350, 15, 15, 15, 351, 352, 353, 354, 355, 356, 357, 142, 358,
+    359, 50, 360, 361, 50, 50, 50, 362, 363, 50, 50, 364, 365, 194, 34, 366,
+    66, 50, 367, 50, 368, 369, 50, 153, 78, 50, 50, 370, 371, 372, 373, 374,
+    50, 50, 375, 376, 377, 378, 50, 379, 50, 50, 50, 380, 381, 382, 383, 384,
+    385, 386, 317, 13, 13, 387, 388, 13, 13, 13, 13, 13, 50, 50, 389, 194,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 390, 50, 391, 50, 50, 208,
+    392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392,
+    392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 206, 50, 50, 50, 50, 50, 50, 209, 142, 142,
+    394, 395, 396, 397, 398, 50, 50, 50, 50, 50, 50, 399, 400, 401, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 402, 211, 50, 50, 50, 50, 403, 50, 50, 404, 142, 142, 405,
+    34, 406, 34, 407, 408, 409, 410, 411, 50, 50, 50, 50, 50, 50, 50, 412,
+    413, 3, 4, 5, 6, 414, 415, 416, 50, 417, 50, 202, 418, 419, 420, 421,
+    422, 50, 174, 423, 206, 206, 142, 142, 50, 50, 50, 50, 50, 50, 50, 73,
+    424, 273, 273, 425, 274, 274, 274, 426, 427, 428, 429, 142, 142, 211, 211, 430,
+    142, 142, 142, 142, 142, 142, 142, 142, 50, 153, 50, 50, 50, 102, 431, 432,
+    50, 50, 433, 50, 434, 50, 50, 435, 50, 436, 50, 50, 437, 438, 142, 142,
+    11, 11, 439, 13, 13, 50, 50, 50, 50, 206, 194, 11, 11, 440, 13, 441,
+    50, 50, 442, 50, 50, 50, 443, 444, 444, 445, 446, 447, 142, 142, 142, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 316, 50, 201, 442, 142, 448, 29, 29, 449, 142, 142, 142, 142,
+    450, 50, 50, 451, 50, 452, 50, 453, 50, 202, 454, 142, 142, 142, 50, 455,
+    50, 456, 50, 457, 142, 142, 142, 142, 50, 50, 50, 458, 273, 459, 273, 273,
+    460, 461, 50, 462, 463, 464, 50, 465, 50, 466, 142, 142, 467, 50, 468, 469,
+    50, 50, 50, 470, 50, 471, 50, 472, 50, 473, 474, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 198, 142, 142, 142, 11, 11, 11, 475, 13, 13, 13, 476,
+    50, 50, 477, 194, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 273, 478, 50, 50, 479, 480, 142, 142, 142, 142,
+    50, 466, 481, 50, 64, 482, 142, 50, 483, 142, 142, 50, 484, 142, 50, 316,
+    485, 50, 50, 486, 487, 459, 488, 489, 224, 50, 50, 490, 491, 50, 198, 194,
+    492, 50, 493, 494, 495, 50, 50, 496, 224, 50, 50, 497, 498, 499, 500, 501,
+    50, 99, 502, 503, 142, 142, 142, 142, 504, 505, 506, 50, 50, 507, 508, 194,
+    509, 85, 86, 510, 511, 512, 513, 514, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 515, 516, 517, 480, 142, 50, 50, 50, 518, 519, 194, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 50, 50, 520, 521, 522, 523, 142, 142,
+    50, 50, 50, 524, 525, 194, 526, 142, 50, 50, 527, 528, 194, 142, 142, 142,
+    50, 175, 529, 530, 316, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 502, 531, 142, 142, 142, 142, 142, 142, 11, 11, 13, 13, 150, 532,
+    533, 534, 50, 535, 536, 194, 142, 142, 142, 142, 537, 50, 50, 538, 539, 142,
+    540, 50, 50, 541, 542, 543, 50, 50, 544, 545, 546, 50, 50, 50, 50, 198,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    86, 50, 520, 547, 548, 150, 177, 549, 50, 550, 551, 552, 142, 142, 142, 142,
+    553, 50, 50, 554, 555, 194, 556, 50, 557, 558, 194, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 50, 559,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 102, 273, 560, 561, 562,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 209, 142, 142, 142, 142, 142, 142,
+    274, 274, 274, 274, 274, 274, 563, 564, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 390, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 50, 50, 50, 50, 50, 50, 565,
+    50, 50, 202, 566, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 316, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 198, 50, 202, 372, 50, 50, 50, 50, 202, 194, 50, 206, 567,
+    50, 50, 50, 568, 569, 570, 571, 572, 50, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 11, 11, 13, 13, 273, 573, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 574, 575, 576, 576, 577, 578, 142, 142, 142, 142, 579, 580,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 442,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 201, 142, 142,
+    198, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 581,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 582, 142, 142, 582, 583, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 208,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 50, 50, 73, 153, 198, 584, 585, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    34, 34, 586, 34, 587, 211, 211, 211, 211, 211, 211, 211, 325, 142, 142, 142,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 326,
+    211, 211, 588, 211, 211, 211, 589, 590, 591, 211, 592, 211, 211, 211, 290, 142,
+    211, 211, 211, 211, 593, 142, 142, 142, 142, 142, 142, 142, 142, 142, 273, 594,
+    211, 211, 211, 211, 211, 289, 273, 463, 142, 142, 142, 142, 142, 142, 142, 142,
+    11, 595, 13, 596, 597, 598, 243, 11, 599, 600, 601, 602, 603, 11, 595, 13,
+    604, 605, 13, 606, 607, 608, 609, 11, 610, 13, 11, 595, 13, 596, 597, 13,
+    243, 11, 599, 609, 11, 610, 13, 11, 595, 13, 611, 11, 612, 613, 614, 615,
+    13, 616, 11, 617, 618, 619, 620, 13, 621, 11, 622, 13, 623, 624, 624, 624,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    34, 34, 34, 625, 34, 34, 626, 627, 628, 629, 47, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    630, 631, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    632, 633, 634, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 153, 635, 636, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 50, 637, 142, 50, 50, 638, 639,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 640, 202,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 641, 587, 142, 142,
+    11, 11, 599, 13, 642, 372, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 500, 273, 273, 643, 644, 142, 142, 142, 142,
+    500, 273, 645, 646, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    647, 50, 648, 649, 650, 651, 652, 653, 654, 208, 655, 208, 142, 142, 142, 656,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    211, 211, 327, 211, 211, 211, 211, 211, 211, 325, 336, 657, 657, 657, 211, 326,
+    658, 211, 211, 211, 211, 211, 211, 211, 211, 211, 659, 142, 142, 142, 660, 211,
+    661, 211, 211, 327, 662, 663, 326, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 664,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 665, 428, 428,
+    211, 211, 211, 211, 211, 211, 211, 325, 211, 211, 211, 211, 211, 662, 327, 429,
+    327, 211, 211, 211, 666, 178, 211, 211, 666, 211, 659, 663, 142, 142, 142, 142,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 325, 659, 667, 289, 211, 428, 290, 326, 178, 666, 289,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 668, 211, 211, 290, 142, 142, 194,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 142, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 198, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 206, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 480, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 102, 142,
+    50, 206, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 73, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    669, 142, 670, 670, 670, 670, 670, 670, 142, 142, 142, 142, 142, 142, 142, 142,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 142,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 671,
+};
+
+inline constexpr std::uint8_t property_data[] = {
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 58, 58, 58, 58, 58, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    55, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 19, 19, 19, 18,
+    18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 18, 15, 21, 12,
+    21, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 19, 15, 19, 26,
+    26, 26, 26, 26, 26, 58, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    55, 18, 20, 20, 20, 20, 22, 18, 21, 22, 5, 16, 19, 27, 22, 21,
+    22, 19, 11, 11, 21, 2, 18, 18, 21, 11, 5, 17, 11, 11, 11, 18,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 19, 1, 1, 1, 1, 1, 1, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 1, 2, 2,
+    2, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 1, 1,
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1,
+    1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 2, 1, 2, 1, 1,
+    2, 1, 1, 1, 2, 1, 2, 1, 1, 2, 2, 5, 1, 2, 2, 2,
+    5, 5, 5, 5, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2,
+    2, 1, 3, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 1, 1, 2,
+    2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 21, 21, 21, 21, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    4, 4, 4, 4, 4, 21, 21, 21, 21, 21, 21, 21, 4, 21, 4, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    1, 2, 1, 2, 4, 21, 1, 2, 0, 0, 4, 2, 2, 2, 18, 1,
+    0, 0, 0, 0, 21, 21, 1, 18, 1, 1, 1, 0, 1, 0, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+    2, 2, 1, 1, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 1, 2, 19, 1, 2, 1, 1, 2, 2, 1, 1, 1,
+    1, 2, 22, 6, 6, 6, 6, 6, 8, 8, 1, 2, 1, 2, 1, 2,
+    1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 4, 18, 18, 18, 18, 18, 18,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18, 13, 0, 0, 22, 22, 20,
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13, 6,
+    18, 6, 6, 18, 6, 6, 18, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5,
+    5, 5, 5, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 19, 19, 19, 18, 18, 20, 18, 18, 22, 22,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 27, 18, 18, 18,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 5, 5,
+    6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 18, 5, 6, 6, 6, 6, 6, 6, 6, 27, 22, 6,
+    6, 6, 6, 6, 6, 4, 4, 6, 6, 22, 6, 6, 6, 6, 5, 5,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 22, 22, 5,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 27,
+    5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 4, 4, 22, 18, 18, 18, 4, 0, 0, 6, 20, 20,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 4, 6, 6, 6, 4, 6, 6, 6, 6, 6, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 0, 0, 18, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 21, 5, 5, 5, 5, 5, 5, 0,
+    27, 27, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 6, 6, 6, 6, 6, 6,
+    6, 6, 27, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 6, 7, 7,
+    5, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 6, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    18, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 0, 0, 0, 5, 5, 5, 5, 0, 0, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 0, 0, 7, 7, 0, 0, 7, 7, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 5, 5, 0, 5,
+    5, 5, 6, 6, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    5, 5, 20, 20, 11, 11, 11, 11, 11, 11, 22, 20, 5, 18, 6, 0,
+    0, 6, 6, 7, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5,
+    5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 0, 6, 0, 7, 7,
+    7, 6, 6, 0, 0, 0, 0, 6, 6, 0, 0, 6, 6, 6, 0, 0,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 6, 5, 5, 5, 6, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 6, 0, 6, 6, 7, 0, 7, 7, 6, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 20, 0, 0, 0, 0, 0, 0, 0, 5, 6, 6, 6, 6, 6, 6,
+    0, 6, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 6, 5, 7, 6,
+    7, 6, 6, 6, 6, 0, 0, 7, 7, 0, 0, 7, 7, 6, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 7, 0, 0, 0, 0, 5, 5, 0, 5,
+    22, 5, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 5, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 0, 0, 0, 5, 5, 0, 5, 0, 5, 5,
+    0, 0, 0, 5, 5, 0, 0, 0, 5, 5, 5, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 7, 7,
+    6, 7, 7, 0, 0, 0, 7, 7, 7, 0, 7, 7, 7, 6, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 22, 22, 22, 22, 22, 22, 20, 22, 0, 0, 0, 0, 0,
+    6, 7, 7, 7, 6, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 6, 5, 6, 6,
+    6, 7, 7, 7, 7, 0, 6, 6, 6, 0, 6, 6, 6, 6, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 0, 5, 5, 5, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 18, 11, 11, 11, 11, 11, 11, 11, 22,
+    5, 6, 7, 7, 18, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 6, 5, 7, 6,
+    7, 7, 7, 7, 7, 0, 6, 7, 7, 0, 7, 7, 6, 6, 0, 0,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+    0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 0, 7, 7, 7, 0, 7, 7, 7, 6, 5, 22,
+    0, 0, 0, 0, 5, 5, 5, 7, 11, 11, 11, 11, 11, 11, 11, 5,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 5, 5, 5, 5, 5, 5,
+    0, 6, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 6, 0, 0, 0, 0, 7,
+    7, 7, 6, 6, 6, 0, 6, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+    0, 0, 7, 7, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 20,
+    5, 5, 5, 5, 5, 5, 4, 6, 6, 6, 6, 6, 6, 6, 6, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 0, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 0, 0,
+    5, 5, 5, 5, 5, 0, 4, 0, 6, 6, 6, 6, 6, 6, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 5, 5, 5, 5,
+    5, 22, 22, 22, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 22, 18, 22, 22, 22, 6, 6, 22, 22, 22, 22, 22, 22,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 22, 6, 22, 6, 22, 6, 14, 15, 14, 15, 7, 7,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+    6, 6, 6, 6, 6, 18, 6, 6, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 22, 22,
+    22, 22, 22, 22, 22, 22, 6, 22, 22, 22, 22, 22, 22, 0, 22, 22,
+    18, 18, 18, 18, 18, 22, 22, 22, 22, 18, 18, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 6, 6, 6,
+    6, 7, 6, 6, 6, 6, 6, 6, 7, 6, 6, 7, 7, 6, 6, 5,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 18, 18,
+    5, 5, 5, 5, 5, 5, 7, 7, 6, 6, 5, 5, 5, 5, 6, 6,
+    6, 5, 7, 7, 7, 5, 5, 7, 7, 7, 7, 7, 7, 7, 5, 5,
+    5, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 7, 7, 6, 6, 7, 7, 7, 7, 7, 7, 6, 5, 7,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 7, 7, 7, 6, 22, 22,
+    1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18, 4, 2, 2, 2,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 6, 6, 6,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+    13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 22, 18, 5,
+    55, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 15, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 18, 18, 10, 10,
+    10, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, 6, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    5, 5, 6, 6, 7, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+    7, 7, 7, 7, 7, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 18, 18, 18, 4, 18, 18, 18, 20, 5, 6, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 13, 18, 18, 18, 18, 6, 6, 6, 27, 6,
+    5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    6, 6, 6, 7, 7, 7, 7, 6, 6, 7, 7, 7, 0, 0, 0, 0,
+    7, 7, 6, 7, 7, 7, 7, 7, 7, 6, 6, 6, 0, 0, 0, 0,
+    22, 0, 0, 0, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 0, 0, 0, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 7, 7, 6, 0, 0, 18, 18,
+    5, 5, 5, 5, 5, 7, 6, 7, 6, 6, 6, 6, 6, 6, 6, 0,
+    6, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6,
+    18, 18, 18, 18, 18, 18, 18, 4, 18, 18, 18, 18, 18, 18, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0,
+    6, 6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 6, 7, 6, 6, 6, 6, 6, 7, 6, 7, 7, 7,
+    7, 7, 6, 7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    18, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 18, 18, 0,
+    6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 7, 6, 6, 6, 6, 7, 7, 6, 6, 7, 6, 6, 6, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 7, 6, 6, 7, 7, 7, 6, 7, 6,
+    6, 6, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18,
+    5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6,
+    6, 6, 6, 6, 7, 7, 6, 6, 0, 0, 0, 18, 18, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 18, 18,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+    18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 18, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 7, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 6, 5, 5,
+    5, 5, 5, 5, 6, 5, 5, 7, 6, 6, 5, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4,
+    1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1, 0, 1, 0, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 21, 2, 21,
+    21, 21, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 21, 21, 21,
+    2, 2, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 0, 21, 21, 21,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 21, 21, 21,
+    0, 0, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 21, 21, 0,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 27, 27, 27, 27, 27,
+    13, 13, 13, 13, 13, 13, 18, 18, 16, 17, 14, 16, 16, 17, 14, 16,
+    18, 18, 18, 18, 18, 18, 18, 18, 56, 57, 27, 27, 27, 27, 27, 55,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 16, 17, 18, 18, 18, 18, 12,
+    12, 18, 18, 18, 19, 14, 15, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 19, 18, 12, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 55,
+    27, 27, 27, 27, 27, 0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    11, 4, 0, 0, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 4,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8,
+    8, 6, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 1, 22, 22, 22, 22, 1, 22, 22, 2, 1, 1, 1, 2, 2,
+    1, 1, 1, 2, 22, 1, 22, 22, 19, 1, 1, 1, 1, 1, 22, 22,
+    22, 22, 22, 22, 1, 22, 1, 22, 1, 22, 1, 1, 1, 1, 22, 2,
+    1, 1, 1, 1, 2, 5, 5, 5, 5, 2, 22, 22, 2, 2, 1, 1,
+    19, 19, 19, 19, 19, 1, 2, 2, 2, 2, 22, 19, 22, 22, 2, 22,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 1, 2, 10, 10, 10, 10, 11, 22, 22, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 19, 19, 22, 22, 22, 22,
+    19, 22, 22, 19, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 19, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19,
+    22, 22, 19, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 22, 22, 22, 22,
+    19, 19, 22, 22, 22, 22, 22, 22, 22, 14, 15, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19,
+    19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11,
+    22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19,
+    22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    19, 19, 19, 19, 19, 14, 15, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 19, 19,
+    19, 19, 19, 19, 19, 22, 22, 19, 19, 19, 19, 19, 19, 22, 22, 22,
+    22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    1, 2, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1,
+    1, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 4, 4, 1, 1,
+    1, 2, 1, 2, 2, 22, 22, 22, 22, 22, 22, 1, 2, 1, 2, 6,
+    6, 6, 1, 2, 0, 0, 0, 0, 0, 18, 18, 18, 18, 11, 18, 18,
+    2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 4,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    18, 18, 16, 17, 16, 17, 18, 18, 18, 16, 17, 18, 16, 17, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 13, 18, 18, 13, 18, 16, 17, 18, 18,
+    16, 17, 14, 15, 14, 15, 14, 15, 14, 15, 18, 18, 18, 18, 18, 4,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 13, 18, 18, 18, 18,
+    13, 18, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    22, 22, 18, 18, 18, 14, 15, 14, 15, 14, 15, 14, 15, 13, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+    55, 18, 18, 18, 22, 4, 5, 10, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15, 13, 14, 15, 15,
+    22, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 6, 6, 6, 7, 7,
+    13, 4, 4, 4, 4, 4, 22, 22, 10, 10, 10, 4, 5, 18, 22, 22,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 6, 6, 21, 21, 4, 4, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 4, 4, 4, 5,
+    0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    22, 22, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11,
+    22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 0, 0, 0, 0,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 6,
+    8, 8, 8, 18, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 4,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4, 4, 6, 6,
+    5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    6, 6, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    21, 21, 21, 21, 21, 21, 21, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    21, 21, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    4, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 4, 21, 21, 1, 2, 1, 2, 5,
+    1, 2, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2,
+    1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 0, 0, 0, 0, 0,
+    1, 2, 0, 2, 0, 2, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 1, 2, 5, 4, 4, 2, 5, 5, 5, 5, 5,
+    5, 5, 6, 5, 5, 5, 6, 5, 5, 5, 5, 6, 5, 5, 5, 5,
+    5, 5, 5, 7, 7, 6, 6, 7, 22, 22, 22, 22, 6, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 22, 22, 20, 22, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18,
+    6, 6, 5, 5, 5, 5, 5, 5, 18, 18, 18, 5, 18, 5, 5, 6,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 18, 18,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    5, 5, 5, 6, 7, 7, 6, 6, 6, 6, 7, 7, 6, 6, 7, 7,
+    7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 4,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 18, 18,
+    5, 5, 5, 5, 5, 6, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7,
+    7, 6, 6, 7, 7, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 18, 18, 18, 18,
+    4, 5, 5, 5, 5, 5, 5, 22, 22, 22, 5, 7, 6, 7, 5, 5,
+    6, 5, 6, 6, 6, 5, 5, 6, 6, 5, 5, 5, 5, 5, 6, 6,
+    5, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 4, 18, 18,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 6, 6, 7, 7,
+    18, 18, 5, 4, 4, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 0,
+    0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 21, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 21, 21, 0, 0, 0, 0,
+    5, 5, 5, 7, 7, 6, 7, 7, 6, 7, 7, 18, 7, 6, 0, 0,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 5, 6, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 19, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 0,
+    5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 15, 14,
+    0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 22,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 20, 22, 22, 22,
+    18, 18, 18, 18, 18, 18, 18, 14, 15, 18, 0, 0, 0, 0, 0, 0,
+    18, 13, 13, 12, 12, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 18, 18, 14, 15, 18, 18, 18, 18, 12, 12, 12,
+    18, 18, 18, 0, 18, 18, 18, 18, 13, 14, 15, 14, 15, 14, 15, 18,
+    18, 18, 19, 13, 19, 19, 19, 0, 18, 20, 18, 18, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 27,
+    0, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 19, 15, 19, 14,
+    15, 18, 14, 15, 18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4,
+    0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5,
+    0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 0, 0, 0,
+    20, 20, 19, 21, 22, 20, 20, 0, 22, 19, 19, 19, 19, 22, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 22, 22, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 5,
+    18, 18, 18, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    10, 10, 10, 10, 10, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 22, 22, 22, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 0, 0,
+    6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+    11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5,
+    5, 10, 5, 5, 5, 5, 5, 5, 5, 5, 10, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 18,
+    5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    18, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 0, 0, 5, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 0, 18, 11, 11, 11, 11, 11, 11, 11, 11,
+    5, 5, 5, 5, 5, 5, 5, 22, 22, 11, 11, 11, 11, 11, 11, 11,
+    0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    5, 5, 5, 0, 5, 5, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+    5, 5, 5, 5, 5, 5, 11, 11, 11, 11, 11, 11, 0, 0, 0, 18,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 18,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 11, 11, 5, 5,
+    0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    5, 6, 6, 6, 0, 6, 6, 0, 0, 0, 0, 0, 6, 6, 6, 6,
+    5, 5, 5, 5, 0, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 0, 6, 6, 6, 0, 0, 0, 0, 6,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 18,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 11,
+    5, 5, 5, 5, 5, 5, 5, 5, 22, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 6, 6, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+    18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18,
+    5, 5, 5, 5, 5, 5, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11,
+    5, 5, 5, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11,
+    5, 5, 5, 5, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 6, 6, 13, 0, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 11, 11, 11, 11, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, 6, 6, 6, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+    7, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 18, 18, 18, 18, 0, 0,
+    11, 11, 11, 11, 11, 11, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 5, 5, 6, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    7, 7, 7, 6, 6, 6, 6, 7, 7, 6, 6, 18, 18, 27, 18, 18,
+    18, 18, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 6, 6, 6,
+    6, 6, 6, 6, 6, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    18, 18, 18, 18, 5, 7, 7, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 6, 18, 18, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+    7, 5, 5, 5, 5, 18, 18, 18, 18, 6, 6, 6, 6, 18, 7, 6,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 18, 5, 18, 18, 18,
+    0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6,
+    6, 6, 7, 7, 6, 7, 6, 6, 18, 18, 18, 18, 18, 18, 6, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+    6, 6, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 6, 6, 5, 7, 7,
+    6, 7, 7, 7, 7, 0, 0, 7, 7, 0, 0, 7, 7, 7, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 5, 5, 5,
+    5, 5, 7, 7, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+    6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 6, 6, 6, 7, 6, 5, 5, 5, 5, 18, 18, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 0, 18, 6, 5,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 7, 6, 7, 7, 7, 7, 6,
+    6, 7, 6, 6, 5, 5, 18, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7,
+    7, 7, 6, 6, 6, 6, 0, 0, 7, 7, 7, 7, 6, 6, 7, 6,
+    6, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 5, 5, 5, 5, 6, 6, 0, 0,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 6, 7, 6,
+    6, 18, 18, 18, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 7, 7,
+    6, 6, 6, 6, 6, 6, 7, 6, 5, 18, 0, 0, 0, 0, 0, 0,
+    7, 7, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 18, 18, 18, 22,
+    6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 18, 0, 0, 0, 0,
+    11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 0, 0, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    7, 7, 7, 7, 7, 7, 0, 7, 7, 0, 0, 6, 6, 7, 6, 5,
+    7, 5, 7, 6, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5,
+    5, 7, 7, 7, 6, 6, 6, 6, 0, 0, 6, 6, 7, 7, 7, 7,
+    6, 5, 18, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5,
+    5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 5, 6, 6, 6, 6, 18,
+    18, 18, 18, 18, 18, 18, 18, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 18, 18, 18, 5, 18, 18,
+    18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 7, 6,
+    5, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 0, 7, 6, 6, 6, 6, 6, 6,
+    6, 7, 6, 6, 7, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 6, 6, 0, 0, 0, 6, 0, 6, 6, 0, 6,
+    6, 6, 6, 6, 6, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 0,
+    6, 6, 0, 7, 7, 6, 7, 6, 5, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 6, 6, 7, 7, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 20, 20, 20,
+    20, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0,
+    18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 18, 18, 22, 22, 22, 22,
+    4, 4, 4, 4, 18, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 11, 11, 11, 11, 11,
+    11, 11, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 5, 5, 5,
+    11, 11, 11, 11, 11, 11, 11, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 6,
+    5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 18, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0,
+    5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 22, 6, 6, 18,
+    27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 7, 7, 6, 6, 6, 22, 22, 22, 7, 7, 7,
+    7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 6, 6, 6, 6, 6,
+    6, 6, 6, 22, 22, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 6, 6, 22, 22,
+    22, 22, 6, 6, 6, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 1, 1,
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2,
+    2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 0, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2,
+    2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19,
+    2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 1, 2, 0, 0, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22,
+    22, 22, 22, 22, 22, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 6, 22, 22, 18, 18, 18, 18, 18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6, 6, 6, 6, 6,
+    6, 6, 0, 6, 6, 0, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 5, 22,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 20,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 5, 0,
+    5, 5, 5, 5, 5, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    2, 2, 2, 2, 6, 6, 6, 6, 6, 6, 6, 4, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11,
+    20, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0,
+    5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 5, 0, 5, 0, 0, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 0, 5, 0, 0, 0, 0,
+    0, 0, 5, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 5, 5,
+    0, 5, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 5, 0, 5, 0, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5,
+    5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5,
+    0, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5,
+    19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 21, 21,
+    22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 0, 0, 0,
+    22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0,
+};
+
+constexpr std::uint8_t property_lookup(uint_t cp) noexcept
+{
+    const uint_t block = property_stage2[(property_stage1[cp >> 9] << 5) + ((cp >> 4) & 31)];
+    return property_data[(block << 4) + (cp & 15)];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// simple case folding, index of difference between folded and source code point, 3360 bytes
+
+inline constexpr std::uint8_t fold_stage1[] = {
+    0, 1, 2, 2, 3, 2, 2, 4, 5, 6, 2, 7, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 9, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10,
+    2, 11, 2, 12, 2, 2, 13, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+
+inline constexpr std::uint8_t fold_stage2[] = {
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 4, 5, 0, 0,
+    6, 6, 6, 7, 8, 6, 6, 9, 10, 11, 12, 13, 14, 15, 6, 16,
+    6, 6, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, 0, 0, 21, 22, 1, 23, 0, 24, 25, 6, 26,
+    27, 4, 4, 0, 0, 0, 6, 6, 28, 6, 6, 6, 29, 6, 6, 6,
+    6, 6, 6, 30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 34, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+    0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 37, 38, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 39, 6, 6, 6, 6, 6, 6,
+    40, 35, 40, 40, 35, 41, 40, 0, 40, 40, 40, 42, 43, 44, 45, 46,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 47, 48, 0, 0, 49, 0, 50, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    31, 31, 31, 0, 0, 0, 53, 54, 6, 6, 6, 6, 6, 6, 55, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 57, 0, 6, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 59, 59, 6, 6, 6, 60, 61, 62, 63, 64, 65, 66, 0, 67,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    69, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 71, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 72, 72, 73, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 74, 75, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    76, 76, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint8_t fold_data[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 4, 3, 0, 3, 0, 3, 0, 5,
+    0, 6, 3, 0, 3, 0, 7, 3, 0, 8, 8, 3, 0, 0, 9, 10,
+    11, 3, 0, 8, 12, 0, 13, 14, 3, 0, 0, 0, 13, 15, 0, 16,
+    3, 0, 3, 0, 3, 0, 17, 3, 0, 17, 0, 0, 3, 0, 17, 3,
+    0, 18, 18, 3, 0, 3, 0, 19, 3, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 20, 3, 0, 20, 3, 0, 20, 3, 0, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0,
+    0, 20, 3, 0, 3, 0, 21, 22, 3, 0, 3, 0, 3, 0, 3, 0,
+    23, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 25, 26, 0,
+    0, 3, 0, 27, 28, 29, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 30,
+    0, 0, 0, 0, 0, 0, 31, 0, 32, 32, 32, 0, 33, 0, 34, 34,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+    36, 37, 0, 0, 0, 38, 39, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    40, 41, 0, 0, 42, 43, 0, 3, 0, 44, 3, 0, 0, 23, 23, 23,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0,
+    46, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0,
+    0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 0, 48, 0, 0, 0, 0, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 0, 0,
+    50, 51, 52, 53, 53, 54, 55, 56, 57, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 58, 58, 58,
+    3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 59, 0, 0, 60, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 49, 0, 49, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 61, 61, 62, 0, 63, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 62, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 65, 65, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 66, 66, 44, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 68, 68, 62, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 70, 71, 0, 0, 0, 0,
+    0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    3, 0, 75, 76, 77, 0, 0, 3, 0, 3, 0, 3, 0, 78, 79, 80,
+    81, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 83, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 3, 0, 84, 0, 0,
+    3, 0, 3, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 85, 86, 87, 88, 85, 0,
+    89, 90, 91, 92, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 41, 93, 94, 3, 0, 3, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97,
+    97, 97, 97, 0, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr std::uint8_t fold_lookup(uint_t cp) noexcept
+{
+    const uint_t block = fold_stage2[(fold_stage1[cp >> 10] << 6) + ((cp >> 4) & 63)];
+    return fold_data[(block << 4) + (cp & 15)];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// differences between folded and source code points
+
+inline constexpr std::int32_t fold_delta[] = {
+    0, 32, 775, 1, -121, -268, 210, 206, 205, 79, 202, 203, 207, 211, 209, 213,
+    214, 218, 217, 219, 2, -97, -56, -130, 10795, -163, 10792, -195, 69, 71, 116, 38,
+    37, 64, 63, 8, -30, -25, -15, -22, -54, -48, -60, -64, -7, 80, 15, 48,
+    7264, -8, -6222, -6221, -6212, -6210, -6211, -6204, -6180, 35267, -3008, -58, -7615, -74, -9, -7173,
+    -86, -100, -112, -128, -126, -7517, -8383, -8262, 28, 16, 26, -10743, -3814, -10727, -10780, -10749,
+    -10783, -10782, -10815, -35332, -42280, -42308, -42319, -42315, -42305, -42258, -42282, -42261, 928, -42307, -35384, -38864,
+    40, 39, 34,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// canonical combining class in bits 0-7, NFC quick check maybe in bit 8, no in bit 9, 8288 bytes
+
+inline constexpr std::uint8_t normalization_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 13, 14, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 16,
+    17, 9, 18, 19, 20, 21, 22, 23, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 24, 25, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 26,
+    9, 9, 9, 9, 27, 9, 9, 9, 28, 9, 29, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+};
+
+inline constexpr std::uint8_t normalization_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 26, 0, 0, 0, 0, 0, 27, 28, 29, 0, 0, 30, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 32, 33, 34, 0, 0,
+    0, 0, 35, 0, 0, 0, 36, 37, 38, 39, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 40, 41,
+    0, 0, 31, 42, 43, 44, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 0, 47, 48, 14, 49, 50, 51, 52,
+    0, 0, 0, 0, 0, 0, 0, 53, 0, 54, 55, 56, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 57, 0, 54, 58, 59, 0, 0, 0, 60,
+    0, 0, 0, 0, 0, 0, 61, 62, 0, 54, 0, 63, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 62, 0, 54, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 57, 0, 54, 64, 65, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 66, 0, 54, 58, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 62, 0, 54, 67, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 62, 68, 54, 69, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 70, 0, 54, 58, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 58, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 72, 0, 73, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 74, 0, 75, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 76, 0, 0, 77, 78, 79, 80, 81, 15, 0, 82, 83, 84,
+    85, 0, 79, 80, 81, 15, 0, 82, 86, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 66, 87, 88, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 90, 91, 0,
+    0, 0, 0, 0, 0, 90, 90, 90, 92, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 94, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 97, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 100, 101, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 93, 103,
+    0, 0, 0, 0, 0, 0, 104, 105, 106, 107, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 108, 0, 95, 0, 0, 0, 0, 109, 110, 0,
+    0, 0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 112, 0, 111, 0,
+    0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 114, 115, 116, 117, 118,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 119, 120, 121, 14, 14, 14, 122, 123,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 125,
+    0, 0, 0, 0, 0, 0, 0, 61, 0, 126, 79, 79, 79, 127, 0, 125,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 130, 131, 132, 133, 0,
+    0, 0, 0, 0, 16, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 118, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 139, 140,
+    0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    141, 0, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 14, 14, 118, 0,
+    0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 143, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 144, 0, 102, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 145, 146, 147, 0, 0, 0, 0, 0, 141, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 148, 149, 150, 151, 152, 56, 56, 56, 56, 56, 56, 56, 148, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 128, 0, 0, 0, 0,
+    0, 0, 0, 153, 0, 152, 150, 154, 155, 150, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 156, 157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 158,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 159, 0, 0, 0, 0, 0, 160, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 163, 164, 101, 0, 0, 0, 0, 0,
+    165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 141, 0, 0, 0, 0, 0, 102, 136,
+    0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0, 0, 0, 0, 0, 0,
+    158, 0, 0, 0, 58, 0, 167, 0, 0, 0, 0, 0, 0, 0, 144, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 102, 168, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 171, 0, 54, 58, 0, 31, 172, 172, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 173, 0, 0, 60, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 174, 175, 176, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 58, 0, 136, 177, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 179, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 174, 180, 144, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 95, 0, 136, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 182, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 0,
+    0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 185, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 188, 189, 190, 191,
+    192, 193, 0, 0, 0, 194, 0, 195, 196, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    184, 14, 14, 198, 199, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 139, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 139, 201, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint16_t normalization_data[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 486, 486, 486, 486, 486, 230, 486, 486,
+    486, 486, 486, 486, 486, 230, 230, 486, 230, 486, 230, 486, 486, 232, 220, 220,
+    220, 220, 232, 472, 220, 220, 220, 220, 220, 202, 202, 476, 476, 476, 476, 458,
+    458, 220, 220, 220, 220, 476, 476, 220, 476, 476, 220, 220, 1, 1, 1, 1,
+    257, 220, 220, 220, 220, 230, 230, 230, 742, 742, 486, 742, 742, 496, 230, 220,
+    220, 220, 230, 230, 230, 220, 220, 0, 230, 230, 230, 220, 220, 220, 220, 230,
+    232, 220, 220, 230, 233, 234, 234, 233, 234, 234, 233, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 512, 0, 0, 0, 0, 0, 0, 0, 0, 512,
+    0, 0, 0, 230, 230, 230, 230, 230, 0, 220, 230, 230, 230, 230, 220, 230,
+    230, 230, 222, 220, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220,
+    230, 230, 220, 230, 230, 222, 228, 230, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 19, 20, 21, 22, 0, 23, 0, 24, 25, 0, 230, 220, 0, 18,
+    30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+    32, 33, 34, 486, 486, 476, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+    35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 220, 230, 0, 0, 230,
+    230, 0, 220, 230, 230, 220, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0,
+    230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+    230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+    230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230,
+    0, 230, 230, 230, 230, 230, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+    230, 220, 220, 220, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 0, 220, 230, 230, 220, 230,
+    230, 220, 230, 230, 230, 220, 220, 220, 27, 28, 29, 230, 230, 230, 220, 230,
+    230, 220, 220, 230, 230, 230, 230, 230, 0, 0, 0, 0, 263, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 230, 220, 230, 230, 0, 0, 0,
+    512, 512, 512, 512, 512, 512, 512, 512, 0, 0, 0, 0, 7, 0, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 512, 512, 0, 512,
+    0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 512, 0, 0, 512, 0,
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 512, 512, 512, 0, 0, 512, 0,
+    0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 0, 512, 512, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 84, 347, 0,
+    0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0,
+    0, 0, 0, 9, 9, 0, 256, 0, 0, 0, 265, 0, 0, 0, 0, 256,
+    103, 103, 9, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+    118, 118, 9, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+    220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 220,
+    0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 512, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 512, 0, 0, 0, 0, 512, 0, 0, 0, 0, 512,
+    0, 512, 0, 0, 0, 0, 0, 0, 0, 129, 130, 512, 132, 512, 512, 0,
+    512, 0, 130, 130, 130, 130, 0, 0, 130, 512, 230, 230, 9, 0, 230, 230,
+    0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    0, 9, 9, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 0, 0,
+    256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+    0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+    0, 228, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 220,
+    230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+    220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 7, 256, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 230, 230, 230, 0, 1, 220, 220, 220,
+    220, 220, 230, 230, 220, 220, 220, 220, 230, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0,
+    230, 230, 0, 0, 0, 0, 0, 0, 230, 230, 220, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 230, 234, 214, 220, 202, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+    0, 512, 0, 512, 0, 512, 0, 512, 0, 512, 0, 512, 0, 512, 0, 0,
+    0, 512, 0, 512, 0, 0, 0, 0, 0, 0, 0, 512, 0, 0, 512, 512,
+    512, 512, 0, 0, 0, 0, 0, 0, 230, 230, 1, 1, 230, 230, 230, 230,
+    1, 1, 1, 230, 230, 0, 0, 0, 0, 230, 0, 0, 0, 1, 1, 230,
+    220, 230, 1, 1, 220, 220, 220, 220, 230, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 512, 512, 0, 0, 0, 0, 0, 512, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 218, 228, 232, 222, 224, 224,
+    0, 264, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+    0, 0, 0, 220, 220, 220, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 230, 0, 230, 230, 220, 0, 0, 230,
+    230, 0, 0, 0, 0, 0, 230, 230, 0, 230, 0, 0, 0, 0, 0, 0,
+    512, 512, 512, 512, 512, 512, 0, 0, 512, 0, 512, 0, 0, 512, 512, 512,
+    512, 512, 512, 512, 512, 512, 512, 0, 512, 0, 512, 0, 0, 512, 512, 0,
+    0, 0, 512, 512, 512, 512, 512, 512, 0, 0, 0, 0, 0, 512, 26, 512,
+    512, 512, 512, 512, 512, 0, 512, 0, 512, 512, 0, 512, 512, 0, 512, 512,
+    230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+    230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+    230, 1, 220, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 230, 220, 0,
+    0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220,
+    230, 230, 230, 220, 230, 220, 220, 220, 0, 0, 230, 220, 230, 220, 0, 0,
+    0, 9, 263, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0,
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0,
+    0, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 256, 0,
+    230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 9, 0, 0, 0, 7, 0,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 256, 0, 0,
+    0, 0, 9, 7, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 7, 0, 9, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 9, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 9, 9, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 6, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 512, 512,
+    512, 512, 512, 512, 512, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+    216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+    220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 512, 512, 512, 512, 512,
+    512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0,
+    230, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 0, 230, 230,
+    220, 220, 220, 220, 220, 220, 220, 0, 230, 230, 7, 0, 0, 0, 0, 0,
+};
+
+constexpr std::uint16_t normalization_lookup(uint_t cp) noexcept
+{
+    const uint_t block = normalization_stage2[(normalization_stage1[cp >> 10] << 7) + ((cp >> 3) & 127)];
+    return normalization_data[(block << 3) + (cp & 7)];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// full canonical decomposition, offset in bits 3-15 and length in bits 0-2, 8800 bytes
+
+inline constexpr std::uint8_t decomposition_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 5, 9, 5, 10, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 5,
+    5, 5, 5, 5, 12, 13, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 15, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+inline constexpr std::uint8_t decomposition_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 0, 24, 25, 26, 27, 28, 29, 30, 0, 0,
+    31, 32, 0, 33, 0, 34, 0, 35, 0, 0, 0, 0, 36, 37, 38, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 43, 44, 0, 45, 0, 0, 0, 0, 0, 0, 46, 47, 0, 0,
+    0, 0, 0, 48, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 50, 51, 0, 0, 0, 52, 0, 0, 53, 0, 0, 0,
+    0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+    0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 58, 59, 60, 61, 62, 63, 64, 65, 0, 0, 0, 0,
+    0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 68, 0, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+    87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+    103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 104, 0, 0, 0, 0, 0, 0, 105, 106, 0, 107, 0, 0, 0,
+    108, 0, 109, 0, 110, 0, 111, 112, 113, 0, 114, 0, 0, 0, 115, 0,
+    0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 118, 119, 120, 121, 0, 122, 123, 124, 125, 126, 0, 127,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 0, 0,
+    0, 158, 159, 160, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 163, 0, 0, 0, 0, 0,
+    0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 169, 170, 0, 0, 0, 0, 171, 172, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+    189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
+    205, 206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint16_t decomposition_data[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 18, 34, 50, 66, 82, 0, 98, 114, 130, 146, 162, 178, 194, 210, 226,
+    0, 242, 258, 274, 290, 306, 322, 0, 0, 338, 354, 370, 386, 402, 0, 0,
+    418, 434, 450, 466, 482, 498, 0, 514, 530, 546, 562, 578, 594, 610, 626, 642,
+    0, 658, 674, 690, 706, 722, 738, 0, 0, 754, 770, 786, 802, 818, 0, 834,
+    850, 866, 882, 898, 914, 930, 946, 962, 978, 994, 1010, 1026, 1042, 1058, 1074, 1090,
+    0, 0, 1106, 1122, 1138, 1154, 1170, 1186, 1202, 1218, 1234, 1250, 1266, 1282, 1298, 1314,
+    1330, 1346, 1362, 1378, 1394, 1410, 0, 0, 1426, 1442, 1458, 1474, 1490, 1506, 1522, 1538,
+    1554, 0, 0, 0, 1570, 1586, 1602, 1618, 0, 1634, 1650, 1666, 1682, 1698, 1714, 0,
+    0, 0, 0, 1730, 1746, 1762, 1778, 1794, 1810, 0, 0, 0, 1826, 1842, 1858, 1874,
+    1890, 1906, 0, 0, 1922, 1938, 1954, 1970, 1986, 2002, 2018, 2034, 2050, 2066, 2082, 2098,
+    2114, 2130, 2146, 2162, 2178, 2194, 0, 0, 2210, 2226, 2242, 2258, 2274, 2290, 2306, 2322,
+    2338, 2354, 2370, 2386, 2402, 2418, 2434, 2450, 2466, 2482, 2498, 2514, 2530, 2546, 2562, 0,
+    2578, 2594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2610,
+    2626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2642, 2658, 2674,
+    2690, 2706, 2722, 2738, 2754, 2771, 2795, 2819, 2843, 2867, 2891, 2915, 2939, 0, 2963, 2987,
+    3011, 3035, 3058, 3074, 0, 0, 3090, 3106, 3122, 3138, 3154, 3170, 3187, 3211, 3234, 3250,
+    3266, 0, 0, 0, 3282, 3298, 0, 0, 3314, 3330, 3347, 3371, 3394, 3410, 3426, 3442,
+    3458, 3474, 3490, 3506, 3522, 3538, 3554, 3570, 3586, 3602, 3618, 3634, 3650, 3666, 3682, 3698,
+    3714, 3730, 3746, 3762, 3778, 3794, 3810, 3826, 3842, 3858, 3874, 3890, 0, 0, 3906, 3922,
+    0, 0, 0, 0, 0, 0, 3938, 3954, 3970, 3986, 4003, 4027, 4051, 4075, 4098, 4114,
+    4131, 4155, 4178, 4194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4209, 4217, 0, 4225, 4234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4257, 0,
+    0, 0, 0, 0, 0, 4266, 4282, 4297, 4306, 4322, 4338, 0, 4354, 0, 4370, 4386,
+    4403, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4426, 4442, 4458, 4474, 4490, 4506,
+    4523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4546, 4562, 4578, 4594, 4610, 0,
+    0, 0, 0, 4626, 4642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4658, 4674, 0, 4690, 0, 0, 0, 4706, 0, 0, 0, 0, 4722, 4738, 4754, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4770, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4786, 0, 0, 0, 0, 0, 0,
+    4802, 4818, 0, 4834, 0, 0, 0, 4850, 0, 0, 0, 0, 4866, 4882, 4898, 0,
+    0, 0, 0, 0, 0, 0, 4914, 4930, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4946, 4962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4978, 4994, 5010, 5026, 0, 0, 5042, 5058, 0, 0, 5074, 5090, 5106, 5122, 5138, 5154,
+    0, 0, 5170, 5186, 5202, 5218, 5234, 5250, 0, 0, 5266, 5282, 5298, 5314, 5330, 5346,
+    5362, 5378, 5394, 5410, 5426, 5442, 0, 0, 5458, 5474, 0, 0, 0, 0, 0, 0,
+    0, 0, 5490, 5506, 5522, 5538, 5554, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5570, 0, 5586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5602, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5618, 0, 0, 0, 0, 0, 0,
+    0, 5634, 0, 0, 5650, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5666, 5682, 5698, 5714, 5730, 5746, 5762, 5778,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5794, 5810, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5826, 5842, 0, 5858,
+    0, 0, 0, 5874, 0, 0, 5890, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5906, 5922, 5938, 0, 0, 5954, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5970, 0, 0, 5986, 6002, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6018, 6034, 0, 0,
+    0, 0, 0, 0, 6050, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6066, 6082, 6098, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6114, 0, 0, 0, 0, 0, 0, 0,
+    6130, 0, 0, 0, 0, 0, 0, 6146, 6162, 0, 6178, 6195, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6218, 6234, 6250, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6266, 0, 6282, 6299, 6322, 0,
+    0, 0, 0, 6338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6354, 0, 0,
+    0, 0, 6370, 0, 0, 0, 0, 6386, 0, 0, 0, 0, 6402, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6418, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6434, 0, 6450, 6466, 0, 6482, 0, 0, 0, 0, 0, 0, 0,
+    0, 6498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6530, 0, 0,
+    0, 0, 6546, 0, 0, 0, 0, 6562, 0, 0, 0, 0, 6578, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6594, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6610, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6626, 0, 6642, 0, 6658, 0, 6674, 0, 6690, 0,
+    0, 0, 6706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6722, 0, 6738, 0, 0,
+    6754, 6770, 0, 6786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6802, 6818, 6834, 6850, 6866, 6882, 6898, 6914, 6931, 6955, 6978, 6994, 7010, 7026, 7042, 7058,
+    7074, 7090, 7106, 7122, 7139, 7163, 7187, 7211, 7234, 7250, 7266, 7282, 7299, 7323, 7346, 7362,
+    7378, 7394, 7410, 7426, 7442, 7458, 7474, 7490, 7506, 7522, 7538, 7554, 7570, 7586, 7603, 7627,
+    7650, 7666, 7682, 7698, 7714, 7730, 7746, 7762, 7779, 7803, 7826, 7842, 7858, 7874, 7890, 7906,
+    7922, 7938, 7954, 7970, 7986, 8002, 8018, 8034, 8050, 8066, 8082, 8098, 8115, 8139, 8163, 8187,
+    8211, 8235, 8259, 8283, 8306, 8322, 8338, 8354, 8370, 8386, 8402, 8418, 8435, 8459, 8482, 8498,
+    8514, 8530, 8546, 8562, 8579, 8603, 8627, 8651, 8675, 8699, 8722, 8738, 8754, 8770, 8786, 8802,
+    8818, 8834, 8850, 8866, 8882, 8898, 8914, 8930, 8947, 8971, 8995, 9019, 9042, 9058, 9074, 9090,
+    9106, 9122, 9138, 9154, 9170, 9186, 9202, 9218, 9234, 9250, 9266, 9282, 9298, 9314, 9330, 9346,
+    9362, 9378, 9394, 9410, 9426, 9442, 9458, 9474, 9490, 9506, 0, 9522, 0, 0, 0, 0,
+    9538, 9554, 9570, 9586, 9603, 9627, 9651, 9675, 9699, 9723, 9747, 9771, 9795, 9819, 9843, 9867,
+    9891, 9915, 9939, 9963, 9987, 10011, 10035, 10059, 10082, 10098, 10114, 10130, 10146, 10162, 10179, 10203,
+    10227, 10251, 10275, 10299, 10323, 10347, 10371, 10395, 10418, 10434, 10450, 10466, 10482, 10498, 10514, 10530,
+    10547, 10571, 10595, 10619, 10643, 10667, 10691, 10715, 10739, 10763, 10787, 10811, 10835, 10859, 10883, 10907,
+    10931, 10955, 10979, 11003, 11026, 11042, 11058, 11074, 11091, 11115, 11139, 11163, 11187, 11211, 11235, 11259,
+    11283, 11307, 11330, 11346, 11362, 11378, 11394, 11410, 11426, 11442, 0, 0, 0, 0, 0, 0,
+    11458, 11474, 11491, 11515, 11539, 11563, 11587, 11611, 11634, 11650, 11667, 11691, 11715, 11739, 11763, 11787,
+    11810, 11826, 11843, 11867, 11891, 11915, 0, 0, 11938, 11954, 11971, 11995, 12019, 12043, 0, 0,
+    12066, 12082, 12099, 12123, 12147, 12171, 12195, 12219, 12242, 12258, 12275, 12299, 12323, 12347, 12371, 12395,
+    12418, 12434, 12451, 12475, 12499, 12523, 12547, 12571, 12594, 12610, 12627, 12651, 12675, 12699, 12723, 12747,
+    12770, 12786, 12803, 12827, 12851, 12875, 0, 0, 12898, 12914, 12931, 12955, 12979, 13003, 0, 0,
+    13026, 13042, 13059, 13083, 13107, 13131, 13155, 13179, 0, 13202, 0, 13219, 0, 13243, 0, 13267,
+    13290, 13306, 13323, 13347, 13371, 13395, 13419, 13443, 13466, 13482, 13499, 13523, 13547, 13571, 13595, 13619,
+    13642, 13658, 13674, 13690, 13706, 13722, 13738, 13754, 13770, 13786, 13802, 13818, 13834, 13850, 0, 0,
+    13867, 13891, 13916, 13948, 13980, 14012, 14044, 14076, 14107, 14131, 14156, 14188, 14220, 14252, 14284, 14316,
+    14347, 14371, 14396, 14428, 14460, 14492, 14524, 14556, 14587, 14611, 14636, 14668, 14700, 14732, 14764, 14796,
+    14827, 14851, 14876, 14908, 14940, 14972, 15004, 15036, 15067, 15091, 15116, 15148, 15180, 15212, 15244, 15276,
+    15306, 15322, 15339, 15362, 15379, 0, 15402, 15419, 15442, 15458, 15474, 15490, 15506, 0, 15521, 0,
+    0, 15530, 15547, 15570, 15587, 0, 15610, 15627, 15650, 15666, 15682, 15698, 15714, 15730, 15746, 15762,
+    15778, 15794, 15811, 15835, 0, 0, 15858, 15875, 15898, 15914, 15930, 15946, 0, 15962, 15978, 15994,
+    16010, 16026, 16043, 16067, 16090, 16106, 16122, 16139, 16162, 16178, 16194, 16210, 16226, 16242, 16258, 16273,
+    0, 0, 16283, 16306, 16323, 0, 16346, 16363, 16386, 16402, 16418, 16434, 16450, 16465, 0, 0,
+    16473, 16481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 16489, 0, 0, 0, 16497, 16506, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16522, 16538, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16554, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16570, 16586, 16602,
+    0, 0, 0, 0, 16618, 0, 0, 0, 0, 16634, 0, 0, 16650, 0, 0, 0,
+    0, 0, 0, 0, 16666, 0, 16682, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16698, 0, 0, 16714, 0, 0, 16730, 0, 16746, 0, 0, 0, 0, 0, 0,
+    16762, 0, 16778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16794, 16810, 16826,
+    16842, 16858, 0, 0, 16874, 16890, 0, 0, 16906, 16922, 0, 0, 0, 0, 0, 0,
+    16938, 16954, 0, 0, 16970, 16986, 0, 0, 17002, 17018, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17034, 17050, 17066, 17082,
+    17098, 17114, 17130, 17146, 0, 0, 0, 0, 0, 0, 17162, 17178, 17194, 17210, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17225, 17233, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17242, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17258, 0, 17274, 0,
+    17290, 0, 17306, 0, 17322, 0, 17338, 0, 17354, 0, 17370, 0, 17386, 0, 17402, 0,
+    17418, 0, 17434, 0, 0, 17450, 0, 17466, 0, 17482, 0, 0, 0, 0, 0, 0,
+    17498, 17514, 0, 17530, 17546, 0, 17562, 17578, 0, 17594, 17610, 0, 17626, 17642, 0, 0,
+    0, 0, 0, 0, 17658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17690, 0, 17706, 0,
+    17722, 0, 17738, 0, 17754, 0, 17770, 0, 17786, 0, 17802, 0, 17818, 0, 17834, 0,
+    17850, 0, 17866, 0, 0, 17882, 0, 17898, 0, 17914, 0, 0, 0, 0, 0, 0,
+    17930, 17946, 0, 17962, 17978, 0, 17994, 18010, 0, 18026, 18042, 0, 18058, 18074, 0, 0,
+    0, 0, 0, 0, 18090, 0, 0, 18106, 18122, 18138, 18154, 0, 0, 0, 18170, 0,
+    18185, 18193, 18201, 18209, 18217, 18225, 18233, 18241, 18249, 18257, 18265, 18273, 18281, 18289, 18297, 18305,
+    18313, 18321, 18329, 18337, 18345, 18353, 18361, 18369, 18377, 18385, 18393, 18401, 18409, 18417, 18425, 18433,
+    18441, 18449, 18457, 18465, 18473, 18481, 18489, 18497, 18505, 18513, 18521, 18529, 18537, 18545, 18553, 18561,
+    18569, 18577, 18585, 18593, 18601, 18609, 18617, 18625, 18633, 18641, 18649, 18657, 18665, 18673, 18681, 18689,
+    18697, 18705, 18713, 18721, 18729, 18737, 18745, 18753, 18761, 18769, 18777, 18785, 18793, 18801, 18809, 18817,
+    18825, 18833, 18841, 18849, 18857, 18865, 18873, 18881, 18889, 18897, 18905, 18913, 18921, 18929, 18937, 18945,
+    18953, 18961, 18969, 18977, 18985, 18993, 19001, 19009, 19017, 19025, 19033, 19041, 19049, 19057, 19065, 19073,
+    19081, 19089, 19097, 19105, 19113, 19121, 19129, 19137, 19145, 19153, 19161, 19169, 19177, 19185, 19193, 19201,
+    19209, 19217, 19225, 19233, 19241, 19249, 19257, 19265, 19273, 19281, 19289, 19297, 19305, 19313, 19321, 19329,
+    19337, 19345, 19353, 19361, 19369, 19377, 19385, 19393, 19401, 19409, 19417, 19425, 19433, 19441, 19449, 19457,
+    19465, 19473, 19481, 19489, 19497, 19505, 19513, 19521, 19529, 19537, 19545, 19553, 19561, 19569, 19577, 19585,
+    19593, 19601, 19609, 19617, 19625, 19633, 19641, 19649, 19657, 19665, 19673, 19681, 19689, 19697, 19705, 19713,
+    19721, 19729, 19737, 19745, 19753, 19761, 19769, 19777, 19785, 19793, 19801, 19809, 19817, 19825, 19833, 19841,
+    19849, 19857, 19865, 19873, 19881, 19889, 19897, 19905, 19913, 19921, 19929, 19937, 19945, 19953, 19961, 19969,
+    19977, 19985, 19993, 20001, 20009, 20017, 20025, 20033, 20041, 20049, 20057, 20065, 20073, 20081, 20089, 20097,
+    20105, 20113, 20121, 20129, 20137, 20145, 20153, 20161, 20169, 20177, 20185, 20193, 20201, 20209, 20217, 20225,
+    20233, 20241, 20249, 20257, 20265, 20273, 20281, 20289, 20297, 20305, 20313, 20321, 20329, 20337, 0, 0,
+    20345, 0, 20353, 0, 0, 20361, 20369, 20377, 20385, 20393, 20401, 20409, 20417, 20425, 20433, 0,
+    20441, 0, 20449, 0, 0, 20457, 20465, 0, 0, 0, 20473, 20481, 20489, 20497, 20505, 20513,
+    20521, 20529, 20537, 20545, 20553, 20561, 20569, 20577, 20585, 20593, 20601, 20609, 20617, 20625, 20633, 20641,
+    20649, 20657, 20665, 20673, 20681, 20689, 20697, 20705, 20713, 20721, 20729, 20737, 20745, 20753, 20761, 20769,
+    20777, 20785, 20793, 20801, 20809, 20817, 20825, 20833, 20841, 20849, 20857, 20865, 20873, 20881, 20889, 20897,
+    20905, 20913, 20921, 20929, 20937, 20945, 20953, 20961, 20969, 20977, 20985, 20993, 21001, 21009, 0, 0,
+    21017, 21025, 21033, 21041, 21049, 21057, 21065, 21073, 21081, 21089, 21097, 21105, 21113, 21121, 21129, 21137,
+    21145, 21153, 21161, 21169, 21177, 21185, 21193, 21201, 21209, 21217, 21225, 21233, 21241, 21249, 21257, 21265,
+    21273, 21281, 21289, 21297, 21305, 21313, 21321, 21329, 21337, 21345, 21353, 21361, 21369, 21377, 21385, 21393,
+    21401, 21409, 21417, 21425, 21433, 21441, 21449, 21457, 21465, 21473, 21481, 21489, 21497, 21505, 21513, 21521,
+    21529, 21537, 21545, 21553, 21561, 21569, 21577, 21585, 21593, 21601, 21609, 21617, 21625, 21633, 21641, 21649,
+    21657, 21665, 21673, 21681, 21689, 21697, 21705, 21713, 21721, 21729, 21737, 21745, 21753, 21761, 21769, 21777,
+    21785, 21793, 21801, 21809, 21817, 21825, 21833, 21841, 21849, 21857, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21866, 0, 21882,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21898, 21914, 21931, 21955, 21978, 21994,
+    22010, 22026, 22042, 22058, 22074, 22090, 22106, 0, 22122, 22138, 22154, 22170, 22186, 0, 22202, 0,
+    22218, 22234, 0, 22250, 22266, 0, 22282, 22298, 22314, 22330, 22346, 22362, 22378, 22394, 22410, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22426, 0, 22442, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22458, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22474, 22490,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22506, 22522, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22538, 22554, 0, 22570, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22586, 22602, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22618, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22634, 22650,
+    22667, 22691, 22715, 22739, 22763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22786, 22802, 22819, 22843, 22867,
+    22891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22913, 22921, 22929, 22937, 22945, 22953, 22961, 22969, 22977, 22985, 22993, 23001, 23009, 23017, 23025, 23033,
+    23041, 23049, 23057, 23065, 23073, 23081, 23089, 23097, 23105, 23113, 23121, 23129, 23137, 23145, 23153, 23161,
+    23169, 23177, 23185, 23193, 23201, 23209, 23217, 23225, 23233, 23241, 23249, 23257, 23265, 23273, 23281, 23289,
+    23297, 23305, 23313, 23321, 23329, 23337, 23345, 23353, 23361, 23369, 23377, 23385, 23393, 23401, 23409, 23417,
+    23425, 23433, 23441, 23449, 23457, 23465, 23473, 23481, 23489, 23497, 23505, 23513, 23521, 23529, 23537, 23545,
+    23553, 23561, 23569, 23577, 23585, 23593, 23601, 23609, 23617, 23625, 23633, 23641, 23649, 23657, 23665, 23673,
+    23681, 23689, 23697, 23705, 23713, 23721, 23729, 23737, 23745, 23753, 23761, 23769, 23777, 23785, 23793, 23801,
+    23809, 23817, 23825, 23833, 23841, 23849, 23857, 23865, 23873, 23881, 23889, 23897, 23905, 23913, 23921, 23929,
+    23937, 23945, 23953, 23961, 23969, 23977, 23985, 23993, 24001, 24009, 24017, 24025, 24033, 24041, 24049, 24057,
+    24065, 24073, 24081, 24089, 24097, 24105, 24113, 24121, 24129, 24137, 24145, 24153, 24161, 24169, 24177, 24185,
+    24193, 24201, 24209, 24217, 24225, 24233, 24241, 24249, 24257, 24265, 24273, 24281, 24289, 24297, 24305, 24313,
+    24321, 24329, 24337, 24345, 24353, 24361, 24369, 24377, 24385, 24393, 24401, 24409, 24417, 24425, 24433, 24441,
+    24449, 24457, 24465, 24473, 24481, 24489, 24497, 24505, 24513, 24521, 24529, 24537, 24545, 24553, 24561, 24569,
+    24577, 24585, 24593, 24601, 24609, 24617, 24625, 24633, 24641, 24649, 24657, 24665, 24673, 24681, 24689, 24697,
+    24705, 24713, 24721, 24729, 24737, 24745, 24753, 24761, 24769, 24777, 24785, 24793, 24801, 24809, 24817, 24825,
+    24833, 24841, 24849, 24857, 24865, 24873, 24881, 24889, 24897, 24905, 24913, 24921, 24929, 24937, 24945, 24953,
+    24961, 24969, 24977, 24985, 24993, 25001, 25009, 25017, 25025, 25033, 25041, 25049, 25057, 25065, 25073, 25081,
+    25089, 25097, 25105, 25113, 25121, 25129, 25137, 25145, 25153, 25161, 25169, 25177, 25185, 25193, 25201, 25209,
+    25217, 25225, 25233, 25241, 25249, 25257, 25265, 25273, 25281, 25289, 25297, 25305, 25313, 25321, 25329, 25337,
+    25345, 25353, 25361, 25369, 25377, 25385, 25393, 25401, 25409, 25417, 25425, 25433, 25441, 25449, 25457, 25465,
+    25473, 25481, 25489, 25497, 25505, 25513, 25521, 25529, 25537, 25545, 25553, 25561, 25569, 25577, 25585, 25593,
+    25601, 25609, 25617, 25625, 25633, 25641, 25649, 25657, 25665, 25673, 25681, 25689, 25697, 25705, 25713, 25721,
+    25729, 25737, 25745, 25753, 25761, 25769, 25777, 25785, 25793, 25801, 25809, 25817, 25825, 25833, 25841, 25849,
+    25857, 25865, 25873, 25881, 25889, 25897, 25905, 25913, 25921, 25929, 25937, 25945, 25953, 25961, 25969, 25977,
+    25985, 25993, 26001, 26009, 26017, 26025, 26033, 26041, 26049, 26057, 26065, 26073, 26081, 26089, 26097, 26105,
+    26113, 26121, 26129, 26137, 26145, 26153, 26161, 26169, 26177, 26185, 26193, 26201, 26209, 26217, 26225, 26233,
+    26241, 26249, 26257, 26265, 26273, 26281, 26289, 26297, 26305, 26313, 26321, 26329, 26337, 26345, 26353, 26361,
+    26369, 26377, 26385, 26393, 26401, 26409, 26417, 26425, 26433, 26441, 26449, 26457, 26465, 26473, 26481, 26489,
+    26497, 26505, 26513, 26521, 26529, 26537, 26545, 26553, 26561, 26569, 26577, 26585, 26593, 26601, 26609, 26617,
+    26625, 26633, 26641, 26649, 26657, 26665, 26673, 26681, 26689, 26697, 26705, 26713, 26721, 26729, 26737, 26745,
+    26753, 26761, 26769, 26777, 26785, 26793, 26801, 26809, 26817, 26825, 26833, 26841, 26849, 26857, 26865, 26873,
+    26881, 26889, 26897, 26905, 26913, 26921, 26929, 26937, 26945, 26953, 26961, 26969, 26977, 26985, 26993, 27001,
+    27009, 27017, 27025, 27033, 27041, 27049, 27057, 27065, 27073, 27081, 27089, 27097, 27105, 27113, 27121, 27129,
+    27137, 27145, 27153, 27161, 27169, 27177, 27185, 27193, 27201, 27209, 27217, 27225, 27233, 27241, 0, 0,
+};
+
+constexpr std::uint16_t decomposition_lookup(uint_t cp) noexcept
+{
+    const uint_t block = decomposition_stage2[(decomposition_stage1[cp >> 10] << 6) + ((cp >> 4) & 63)];
+    return decomposition_data[(block << 4) + (cp & 15)];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// code points of canonical decompositions
+
+inline constexpr std::uint32_t decomposition_units[] = {
+    65, 768, 65, 769, 65, 770, 65, 771, 65, 776, 65, 778, 67, 807, 69, 768,
+    69, 769, 69, 770, 69, 776, 73, 768, 73, 769, 73, 770, 73, 776, 78, 771,
+    79, 768, 79, 769, 79, 770, 79, 771, 79, 776, 85, 768, 85, 769, 85, 770,
+    85, 776, 89, 769, 97, 768, 97, 769, 97, 770, 97, 771, 97, 776, 97, 778,
+    99, 807, 101, 768, 101, 769, 101, 770, 101, 776, 105, 768, 105, 769, 105, 770,
+    105, 776, 110, 771, 111, 768, 111, 769, 111, 770, 111, 771, 111, 776, 117, 768,
+    117, 769, 117, 770, 117, 776, 121, 769, 121, 776, 65, 772, 97, 772, 65, 774,
+    97, 774, 65, 808, 97, 808, 67, 769, 99, 769, 67, 770, 99, 770, 67, 775,
+    99, 775, 67, 780, 99, 780, 68, 780, 100, 780, 69, 772, 101, 772, 69, 774,
+    101, 774, 69, 775, 101, 775, 69, 808, 101, 808, 69, 780, 101, 780, 71, 770,
+    103, 770, 71, 774, 103, 774, 71, 775, 103, 775, 71, 807, 103, 807, 72, 770,
+    104, 770, 73, 771, 105, 771, 73, 772, 105, 772, 73, 774, 105, 774, 73, 808,
+    105, 808, 73, 775, 74, 770, 106, 770, 75, 807, 107, 807, 76, 769, 108, 769,
+    76, 807, 108, 807, 76, 780, 108, 780, 78, 769, 110, 769, 78, 807, 110, 807,
+    78, 780, 110, 780, 79, 772, 111, 772, 79, 774, 111, 774, 79, 779, 111, 779,
+    82, 769, 114, 769, 82, 807, 114, 807, 82, 780, 114, 780, 83, 769, 115, 769,
+    83, 770, 115, 770, 83, 807, 115, 807, 83, 780, 115, 780, 84, 807, 116, 807,
+    84, 780, 116, 780, 85, 771, 117, 771, 85, 772, 117, 772, 85, 774, 117, 774,
+    85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808, 87, 770, 119, 770,
+    89, 770, 121, 770, 89, 776, 90, 769, 122, 769, 90, 775, 122, 775, 90, 780,
+    122, 780, 79, 795, 111, 795, 85, 795, 117, 795, 65, 780, 97, 780, 73, 780,
+    105, 780, 79, 780, 111, 780, 85, 780, 117, 780, 85, 776, 772, 117, 776, 772,
+    85, 776, 769, 117, 776, 769, 85, 776, 780, 117, 776, 780, 85, 776, 768, 117,
+    776, 768, 65, 776, 772, 97, 776, 772, 65, 775, 772, 97, 775, 772, 198, 772,
+    230, 772, 71, 780, 103, 780, 75, 780, 107, 780, 79, 808, 111, 808, 79, 808,
+    772, 111, 808, 772, 439, 780, 658, 780, 106, 780, 71, 769, 103, 769, 78, 768,
+    110, 768, 65, 778, 769, 97, 778, 769, 198, 769, 230, 769, 216, 769, 248, 769,
+    65, 783, 97, 783, 65, 785, 97, 785, 69, 783, 101, 783, 69, 785, 101, 785,
+    73, 783, 105, 783, 73, 785, 105, 785, 79, 783, 111, 783, 79, 785, 111, 785,
+    82, 783, 114, 783, 82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785,
+    83, 806, 115, 806, 84, 806, 116, 806, 72, 780, 104, 780, 65, 775, 97, 775,
+    69, 807, 101, 807, 79, 776, 772, 111, 776, 772, 79, 771, 772, 111, 771, 772,
+    79, 775, 111, 775, 79, 775, 772, 111, 775, 772, 89, 772, 121, 772, 768, 769,
+    787, 776, 769, 697, 59, 168, 769, 913, 769, 183, 917, 769, 919, 769, 921, 769,
+    927, 769, 933, 769, 937, 769, 953, 776, 769, 921, 776, 933, 776, 945, 769, 949,
+    769, 951, 769, 953, 769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769,
+    969, 769, 978, 769, 978, 776, 1045, 768, 1045, 776, 1043, 769, 1030, 776, 1050, 769,
+    1048, 768, 1059, 774, 1048, 774, 1080, 774, 1077, 768, 1077, 776, 1075, 769, 1110, 776,
+    1082, 769, 1080, 768, 1091, 774, 1140, 783, 1141, 783, 1046, 774, 1078, 774, 1040, 774,
+    1072, 774, 1040, 776, 1072, 776, 1045, 774, 1077, 774, 1240, 776, 1241, 776, 1046, 776,
+    1078, 776, 1047, 776, 1079, 776, 1048, 772, 1080, 772, 1048, 776, 1080, 776, 1054, 776,
+    1086, 776, 1256, 776, 1257, 776, 1069, 776, 1101, 776, 1059, 772, 1091, 772, 1059, 776,
+    1091, 776, 1059, 779, 1091, 779, 1063, 776, 1095, 776, 1067, 776, 1099, 776, 1575, 1619,
+    1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620, 1749, 1620, 1729, 1620, 1746, 1620, 2344, 2364,
+    2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364, 2327, 2364, 2332, 2364, 2337, 2364, 2338, 2364,
+    2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519, 2465, 2492, 2466, 2492, 2479, 2492, 2610, 2620,
+    2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620, 2603, 2620, 2887, 2902, 2887, 2878, 2887, 2903,
+    2849, 2876, 2850, 2876, 2962, 3031, 3014, 3006, 3015, 3006, 3014, 3031, 3142, 3158, 3263, 3285,
+    3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398, 3390, 3399, 3390, 3398, 3415, 3545,
+    3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551, 3906, 4023, 3916, 4023, 3921, 4023, 3926, 4023,
+    3931, 4023, 3904, 4021, 3953, 3954, 3953, 3956, 4018, 3968, 4019, 3968, 3953, 3968, 3986, 4023,
+    3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133, 4142, 6917, 6965, 6919, 6965,
+    6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965, 6970, 6965, 6972, 6965, 6974, 6965, 6975, 6965,
+    6978, 6965, 65, 805, 97, 805, 66, 775, 98, 775, 66, 803, 98, 803, 66, 817,
+    98, 817, 67, 807, 769, 99, 807, 769, 68, 775, 100, 775, 68, 803, 100, 803,
+    68, 817, 100, 817, 68, 807, 100, 807, 68, 813, 100, 813, 69, 772, 768, 101,
+    772, 768, 69, 772, 769, 101, 772, 769, 69, 813, 101, 813, 69, 816, 101, 816,
+    69, 807, 774, 101, 807, 774, 70, 775, 102, 775, 71, 772, 103, 772, 72, 775,
+    104, 775, 72, 803, 104, 803, 72, 776, 104, 776, 72, 807, 104, 807, 72, 814,
+    104, 814, 73, 816, 105, 816, 73, 776, 769, 105, 776, 769, 75, 769, 107, 769,
+    75, 803, 107, 803, 75, 817, 107, 817, 76, 803, 108, 803, 76, 803, 772, 108,
+    803, 772, 76, 817, 108, 817, 76, 813, 108, 813, 77, 769, 109, 769, 77, 775,
+    109, 775, 77, 803, 109, 803, 78, 775, 110, 775, 78, 803, 110, 803, 78, 817,
+    110, 817, 78, 813, 110, 813, 79, 771, 769, 111, 771, 769, 79, 771, 776, 111,
+    771, 776, 79, 772, 768, 111, 772, 768, 79, 772, 769, 111, 772, 769, 80, 769,
+    112, 769, 80, 775, 112, 775, 82, 775, 114, 775, 82, 803, 114, 803, 82, 803,
+    772, 114, 803, 772, 82, 817, 114, 817, 83, 775, 115, 775, 83, 803, 115, 803,
+    83, 769, 775, 115, 769, 775, 83, 780, 775, 115, 780, 775, 83, 803, 775, 115,
+    803, 775, 84, 775, 116, 775, 84, 803, 116, 803, 84, 817, 116, 817, 84, 813,
+    116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85, 813, 117, 813, 85, 771,
+    769, 117, 771, 769, 85, 772, 776, 117, 772, 776, 86, 771, 118, 771, 86, 803,
+    118, 803, 87, 768, 119, 768, 87, 769, 119, 769, 87, 776, 119, 776, 87, 775,
+    119, 775, 87, 803, 119, 803, 88, 775, 120, 775, 88, 776, 120, 776, 89, 775,
+    121, 775, 90, 770, 122, 770, 90, 803, 122, 803, 90, 817, 122, 817, 104, 817,
+    116, 776, 119, 778, 121, 778, 383, 775, 65, 803, 97, 803, 65, 777, 97, 777,
+    65, 770, 769, 97, 770, 769, 65, 770, 768, 97, 770, 768, 65, 770, 777, 97,
+    770, 777, 65, 770, 771, 97, 770, 771, 65, 803, 770, 97, 803, 770, 65, 774,
+    769, 97, 774, 769, 65, 774, 768, 97, 774, 768, 65, 774, 777, 97, 774, 777,
+    65, 774, 771, 97, 774, 771, 65, 803, 774, 97, 803, 774, 69, 803, 101, 803,
+    69, 777, 101, 777, 69, 771, 101, 771, 69, 770, 769, 101, 770, 769, 69, 770,
+    768, 101, 770, 768, 69, 770, 777, 101, 770, 777, 69, 770, 771, 101, 770, 771,
+    69, 803, 770, 101, 803, 770, 73, 777, 105, 777, 73, 803, 105, 803, 79, 803,
+    111, 803, 79, 777, 111, 777, 79, 770, 769, 111, 770, 769, 79, 770, 768, 111,
+    770, 768, 79, 770, 777, 111, 770, 777, 79, 770, 771, 111, 770, 771, 79, 803,
+    770, 111, 803, 770, 79, 795, 769, 111, 795, 769, 79, 795, 768, 111, 795, 768,
+    79, 795, 777, 111, 795, 777, 79, 795, 771, 111, 795, 771, 79, 795, 803, 111,
+    795, 803, 85, 803, 117, 803, 85, 777, 117, 777, 85, 795, 769, 117, 795, 769,
+    85, 795, 768, 117, 795, 768, 85, 795, 777, 117, 795, 777, 85, 795, 771, 117,
+    795, 771, 85, 795, 803, 117, 795, 803, 89, 768, 121, 768, 89, 803, 121, 803,
+    89, 777, 121, 777, 89, 771, 121, 771, 945, 787, 945, 788, 945, 787, 768, 945,
+    788, 768, 945, 787, 769, 945, 788, 769, 945, 787, 834, 945, 788, 834, 913, 787,
+    913, 788, 913, 787, 768, 913, 788, 768, 913, 787, 769, 913, 788, 769, 913, 787,
+    834, 913, 788, 834, 949, 787, 949, 788, 949, 787, 768, 949, 788, 768, 949, 787,
+    769, 949, 788, 769, 917, 787, 917, 788, 917, 787, 768, 917, 788, 768, 917, 787,
+    769, 917, 788, 769, 951, 787, 951, 788, 951, 787, 768, 951, 788, 768, 951, 787,
+    769, 951, 788, 769, 951, 787, 834, 951, 788, 834, 919, 787, 919, 788, 919, 787,
+    768, 919, 788, 768, 919, 787, 769, 919, 788, 769, 919, 787, 834, 919, 788, 834,
+    953, 787, 953, 788, 953, 787, 768, 953, 788, 768, 953, 787, 769, 953, 788, 769,
+    953, 787, 834, 953, 788, 834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768,
+    921, 787, 769, 921, 788, 769, 921, 787, 834, 921, 788, 834, 959, 787, 959, 788,
+    959, 787, 768, 959, 788, 768, 959, 787, 769, 959, 788, 769, 927, 787, 927, 788,
+    927, 787, 768, 927, 788, 768, 927, 787, 769, 927, 788, 769, 965, 787, 965, 788,
+    965, 787, 768, 965, 788, 768, 965, 787, 769, 965, 788, 769, 965, 787, 834, 965,
+    788, 834, 933, 788, 933, 788, 768, 933, 788, 769, 933, 788, 834, 969, 787, 969,
+    788, 969, 787, 768, 969, 788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834,
+    969, 788, 834, 937, 787, 937, 788, 937, 787, 768, 937, 788, 768, 937, 787, 769,
+    937, 788, 769, 937, 787, 834, 937, 788, 834, 945, 768, 945, 769, 949, 768, 949,
+    769, 951, 768, 951, 769, 953, 768, 953, 769, 959, 768, 959, 769, 965, 768, 965,
+    769, 969, 768, 969, 769, 945, 787, 837, 945, 788, 837, 945, 787, 768, 837, 945,
+    788, 768, 837, 945, 787, 769, 837, 945, 788, 769, 837, 945, 787, 834, 837, 945,
+    788, 834, 837, 913, 787, 837, 913, 788, 837, 913, 787, 768, 837, 913, 788, 768,
+    837, 913, 787, 769, 837, 913, 788, 769, 837, 913, 787, 834, 837, 913, 788, 834,
+    837, 951, 787, 837, 951, 788, 837, 951, 787, 768, 837, 951, 788, 768, 837, 951,
+    787, 769, 837, 951, 788, 769, 837, 951, 787, 834, 837, 951, 788, 834, 837, 919,
+    787, 837, 919, 788, 837, 919, 787, 768, 837, 919, 788, 768, 837, 919, 787, 769,
+    837, 919, 788, 769, 837, 919, 787, 834, 837, 919, 788, 834, 837, 969, 787, 837,
+    969, 788, 837, 969, 787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969,
+    788, 769, 837, 969, 787, 834, 837, 969, 788, 834, 837, 937, 787, 837, 937, 788,
+    837, 937, 787, 768, 837, 937, 788, 768, 837, 937, 787, 769, 837, 937, 788, 769,
+    837, 937, 787, 834, 837, 937, 788, 834, 837, 945, 774, 945, 772, 945, 768, 837,
+    945, 837, 945, 769, 837, 945, 834, 945, 834, 837, 913, 774, 913, 772, 913, 768,
+    913, 769, 913, 837, 953, 168, 834, 951, 768, 837, 951, 837, 951, 769, 837, 951,
+    834, 951, 834, 837, 917, 768, 917, 769, 919, 768, 919, 769, 919, 837, 8127, 768,
+    8127, 769, 8127, 834, 953, 774, 953, 772, 953, 776, 768, 953, 776, 769, 953, 834,
+    953, 776, 834, 921, 774, 921, 772, 921, 768, 921, 769, 8190, 768, 8190, 769, 8190,
+    834, 965, 774, 965, 772, 965, 776, 768, 965, 776, 769, 961, 787, 961, 788, 965,
+    834, 965, 776, 834, 933, 774, 933, 772, 933, 768, 933, 769, 929, 788, 168, 768,
+    168, 769, 96, 969, 768, 837, 969, 837, 969, 769, 837, 969, 834, 969, 834, 837,
+    927, 768, 927, 769, 937, 768, 937, 769, 937, 837, 180, 8194, 8195, 937, 75, 65,
+    778, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658, 824, 8707, 824, 8712,
+    824, 8715, 824, 8739, 824, 8741, 824, 8764, 824, 8771, 824, 8773, 824, 8776, 824, 61,
+    824, 8801, 824, 8781, 824, 60, 824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819,
+    824, 8822, 824, 8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835, 824, 8838, 824, 8839,
+    824, 8866, 824, 8872, 824, 8873, 824, 8875, 824, 8828, 824, 8829, 824, 8849, 824, 8850,
+    824, 8882, 824, 8883, 824, 8884, 824, 8885, 824, 12296, 12297, 10973, 824, 12363, 12441, 12365,
+    12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373, 12441, 12375, 12441, 12377, 12441, 12379, 12441, 12381,
+    12441, 12383, 12441, 12385, 12441, 12388, 12441, 12390, 12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402,
+    12441, 12402, 12442, 12405, 12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411, 12441, 12411, 12442, 12358,
+    12441, 12445, 12441, 12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441, 12467, 12441, 12469, 12441, 12471,
+    12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479, 12441, 12481, 12441, 12484, 12441, 12486, 12441, 12488,
+    12441, 12495, 12441, 12495, 12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504,
+    12442, 12507, 12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529, 12441, 12530, 12441, 12541,
+    12441, 35912, 26356, 36554, 36040, 28369, 20018, 21477, 40860, 40860, 22865, 37329, 21895, 22856, 25078, 30313,
+    32645, 34367, 34746, 35064, 37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211,
+    34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358, 20919,
+    21214, 25796, 27347, 29200, 30439, 32769, 34310, 34396, 36335, 38706, 39791, 40442, 30860, 31103, 32160, 33737,
+    37636, 40575, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744, 23650, 27155, 28122, 28431,
+    32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712, 25295, 27138, 35582, 20025,
+    23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489, 19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865,
+    35498, 27578, 36784, 27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327,
+    21237, 21570, 22899, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147, 26310, 27511, 36706, 24180,
+    24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244, 32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693,
+    28872, 35010, 35498, 24265, 24565, 25467, 27566, 31806, 29557, 20196, 22265, 23527, 23994, 24604, 29618, 29801,
+    32666, 32838, 37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698, 23534, 23615, 26009,
+    27138, 29134, 30274, 34044, 36988, 40845, 26248, 38446, 21129, 26491, 26611, 27969, 28316, 29705, 30041, 30827,
+    32016, 39006, 20845, 25134, 38520, 20523, 23833, 28138, 36650, 24459, 24900, 26647, 29575, 38534, 21033, 21519,
+    23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041, 37324, 38626, 21311, 28346, 21533, 29136,
+    29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256, 31435, 31520, 31890, 29376, 28825, 35672, 20160, 33590,
+    21050, 20999, 24230, 25299, 31958, 23429, 27934, 26292, 36667, 34892, 38477, 35211, 24275, 20800, 21952, 22618,
+    26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322, 35576, 36920, 37117, 39151,
+    39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813, 21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696,
+    23652, 23662, 24724, 24936, 24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730,
+    30865, 31038, 31049, 31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680, 32244, 32265, 32321, 32626,
+    32773, 33261, 33401, 33401, 33879, 35088, 35222, 35585, 35641, 36051, 36104, 36790, 36920, 38627, 38911, 38971,
+    24693, 148206, 33304, 20006, 20917, 20840, 20352, 20805, 20864, 21191, 21242, 21917, 21845, 21913, 21986, 22618,
+    22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493, 24792, 24910, 24840, 24974, 24928, 25074, 25140,
+    25540, 25628, 25682, 25942, 26228, 26391, 26395, 26454, 27513, 27578, 27969, 28379, 28363, 28450, 28702, 29038,
+    30631, 29237, 29359, 29482, 29809, 29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538, 30528, 30924, 31409,
+    31680, 31867, 32091, 32244, 32574, 32773, 33618, 33775, 34681, 35137, 35206, 35222, 35519, 35576, 35531, 35585,
+    35582, 35565, 35641, 35722, 36104, 36664, 36978, 37273, 37494, 38524, 38627, 38742, 38875, 38911, 38923, 38971,
+    39698, 40860, 141386, 141380, 144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846, 1497, 1460, 1522,
+    1463, 1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488, 1463, 1488, 1464, 1488,
+    1468, 1489, 1468, 1490, 1468, 1491, 1468, 1492, 1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497,
+    1468, 1498, 1468, 1499, 1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508,
+    1468, 1510, 1468, 1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493, 1465, 1489, 1471, 1499,
+    1471, 1508, 1471, 69785, 69818, 69787, 69818, 69797, 69818, 69937, 69927, 69938, 69927, 70471, 70462, 70471,
+    70487, 70841, 70842, 70841, 70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984, 119127, 119141, 119128,
+    119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128, 119141, 119153, 119128, 119141, 119154,
+    119225, 119141, 119226, 119141, 119225, 119141, 119150, 119226, 119141, 119150, 119225, 119141, 119151, 119226, 119141, 119151,
+    20029, 20024, 20033, 131362, 20320, 20398, 20411, 20482, 20602, 20633, 20711, 20687, 13470, 132666, 20813, 20820,
+    20836, 20855, 132380, 13497, 20839, 20877, 132427, 20887, 20900, 20172, 20908, 20917, 168415, 20981, 20995, 13535,
+    21051, 21062, 21106, 21111, 13589, 21191, 21193, 21220, 21242, 21253, 21254, 21271, 21321, 21329, 21338, 21363,
+    21373, 21375, 21375, 21375, 133676, 28784, 21450, 21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608,
+    21666, 21750, 21776, 21843, 21859, 21892, 21892, 21913, 21931, 21939, 21954, 22294, 22022, 22295, 22097, 22132,
+    20999, 22766, 22478, 22516, 22541, 22411, 22578, 22577, 22700, 136420, 22770, 22775, 22790, 22810, 22818, 22882,
+    136872, 136938, 23020, 23067, 23079, 23000, 23142, 14062, 14076, 23304, 23358, 23358, 137672, 23491, 23512, 23527,
+    23539, 138008, 23551, 23558, 24403, 23586, 14209, 23648, 23662, 23744, 23693, 138724, 23875, 138726, 23918, 23915,
+    23932, 24033, 24034, 14383, 24061, 24104, 24125, 24169, 14434, 139651, 14460, 24240, 24243, 24246, 24266, 172946,
+    24318, 140081, 140081, 33281, 24354, 24354, 14535, 144056, 156122, 24418, 24427, 14563, 24474, 24525, 24535, 24569,
+    24705, 14650, 14620, 24724, 141012, 24775, 24904, 24908, 24910, 24908, 24954, 24974, 25010, 24996, 25007, 25054,
+    25074, 25078, 25104, 25115, 25181, 25265, 25300, 25424, 142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634,
+    25541, 25513, 14894, 25705, 25726, 25757, 25719, 14956, 25935, 25964, 143370, 26083, 26360, 26185, 15129, 26257,
+    15112, 15076, 20882, 20885, 26368, 26268, 32941, 17369, 26391, 26395, 26401, 26462, 26451, 144323, 15177, 26618,
+    26501, 26706, 26757, 144493, 26766, 26655, 26900, 15261, 26946, 27043, 27114, 27304, 145059, 27355, 15384, 27425,
+    145575, 27476, 15438, 27506, 27551, 27578, 27579, 146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926,
+    27966, 28023, 27969, 28009, 28024, 28037, 146718, 27956, 28207, 28270, 15667, 28363, 28359, 147153, 28153, 28526,
+    147294, 147342, 28614, 28729, 28702, 28699, 15766, 28746, 28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395,
+    29224, 29237, 29264, 149000, 29312, 29333, 149301, 149524, 29562, 29579, 16044, 29605, 16056, 16056, 29767, 29788,
+    29809, 29829, 29898, 16155, 29988, 150582, 30014, 150674, 30064, 139679, 30224, 151457, 151480, 151620, 16380, 16392,
+    30452, 151795, 151794, 151833, 151859, 30494, 30495, 30495, 30538, 16441, 30603, 16454, 16534, 152605, 30798, 30860,
+    30924, 16611, 153126, 31062, 153242, 153285, 31119, 31211, 16687, 31296, 31306, 31311, 153980, 154279, 154279, 31470,
+    16898, 154539, 31686, 31689, 16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526, 32099, 17153, 32199, 32258,
+    32325, 17204, 156200, 156231, 17241, 156377, 32634, 156478, 32661, 32762, 32773, 156890, 156963, 32864, 157096, 32880,
+    144223, 17365, 32946, 33027, 17419, 33086, 23221, 157607, 157621, 144275, 144284, 33281, 33284, 36766, 17515, 33425,
+    33419, 33437, 21171, 33457, 33459, 33469, 33510, 158524, 33509, 33565, 33635, 33709, 33571, 33725, 33767, 33879,
+    33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707, 34033, 34035, 34070, 160714, 34148, 159532, 17757, 17761,
+    159665, 159954, 17771, 34384, 34396, 34407, 34409, 34473, 34440, 34574, 34530, 34681, 34600, 34667, 34694, 17879,
+    34785, 34817, 17913, 34912, 34915, 161383, 35031, 35038, 17973, 35066, 13499, 161966, 162150, 18110, 18119, 35488,
+    35565, 35722, 35925, 162984, 36011, 36033, 36123, 36215, 163631, 133124, 36299, 36284, 36336, 133342, 36564, 36664,
+    165330, 165357, 37012, 37105, 37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837,
+    38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880, 168970, 19122, 169110, 38923, 38923,
+    38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422, 19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295,
+    172238, 19704, 172293, 172558, 172689, 40635, 19798, 40697, 40702, 40709, 40719, 40726, 40763, 173568,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// primary composites, the first code point in bits 42-62, the second in bits 21-41, composite
+// in bits 0-20, sorted
+
+inline constexpr std::uint64_t composition_pairs[] = {
+    0x0000f0006700226e, 0x0000f40067002260, 0x0000f8006700226f, 0x00010400600000c0,
+    0x00010400602000c1, 0x00010400604000c2, 0x00010400606000c3, 0x0001040060800100,
+    0x0001040060c00102, 0x0001040060e00226, 0x00010400610000c4, 0x0001040061201ea2,
+    0x00010400614000c5, 0x00010400618001cd, 0x0001040061e00200, 0x0001040062200202,
+    0x0001040064601ea0, 0x0001040064a01e00, 0x0001040065000104, 0x0001080060e01e02,
+    0x0001080064601e04, 0x0001080066201e06, 0x00010c0060200106, 0x00010c0060400108,
+    0x00010c0060e0010a, 0x00010c006180010c, 0x00010c0064e000c7, 0x0001100060e01e0a,
+    0x000110006180010e, 0x0001100064601e0c, 0x0001100064e01e10, 0x0001100065a01e12,
+    0x0001100066201e0e, 0x00011400600000c8, 0x00011400602000c9, 0x00011400604000ca,
+    0x0001140060601ebc, 0x0001140060800112, 0x0001140060c00114, 0x0001140060e00116,
+    0x00011400610000cb, 0x0001140061201eba, 0x000114006180011a, 0x0001140061e00204,
+    0x0001140062200206, 0x0001140064601eb8, 0x0001140064e00228, 0x0001140065000118,
+    0x0001140065a01e18, 0x0001140066001e1a, 0x0001180060e01e1e, 0x00011c00602001f4,
+    0x00011c006040011c, 0x00011c0060801e20, 0x00011c0060c0011e, 0x00011c0060e00120,
+    0x00011c00618001e6, 0x00011c0064e00122, 0x0001200060400124, 0x0001200060e01e22,
+    0x0001200061001e26, 0x000120006180021e, 0x0001200064601e24, 0x0001200064e01e28,
+    0x0001200065c01e2a, 0x00012400600000cc, 0x00012400602000cd, 0x00012400604000ce,
+    0x0001240060600128, 0x000124006080012a, 0x0001240060c0012c, 0x0001240060e00130,
+    0x00012400610000cf, 0x0001240061201ec8, 0x00012400618001cf, 0x0001240061e00208,
+    0x000124006220020a, 0x0001240064601eca, 0x000124006500012e, 0x0001240066001e2c,
+    0x0001280060400134, 0x00012c0060201e30, 0x00012c00618001e8, 0x00012c0064601e32,
+    0x00012c0064e00136, 0x00012c0066201e34, 0x0001300060200139, 0x000130006180013d,
+    0x0001300064601e36, 0x0001300064e0013b, 0x0001300065a01e3c, 0x0001300066201e3a,
+    0x0001340060201e3e, 0x0001340060e01e40, 0x0001340064601e42, 0x00013800600001f8,
+    0x0001380060200143, 0x00013800606000d1, 0x0001380060e01e44, 0x0001380061800147,
+    0x0001380064601e46, 0x0001380064e00145, 0x0001380065a01e4a, 0x0001380066201e48,
+    0x00013c00600000d2, 0x00013c00602000d3, 0x00013c00604000d4, 0x00013c00606000d5,
+    0x00013c006080014c, 0x00013c0060c0014e, 0x00013c0060e0022e, 0x00013c00610000d6,
+    0x00013c0061201ece, 0x00013c0061600150, 0x00013c00618001d1, 0x00013c0061e0020c,
+    0x00013c006220020e, 0x00013c00636001a0, 0x00013c0064601ecc, 0x00013c00650001ea,
+    0x0001400060201e54, 0x0001400060e01e56, 0x0001480060200154, 0x0001480060e01e58,
+    0x0001480061800158, 0x0001480061e00210, 0x0001480062200212, 0x0001480064601e5a,
+    0x0001480064e00156, 0x0001480066201e5e, 0x00014c006020015a, 0x00014c006040015c,
+    0x00014c0060e01e60, 0x00014c0061800160, 0x00014c0064601e62, 0x00014c0064c00218,
+    0x00014c0064e0015e, 0x0001500060e01e6a, 0x0001500061800164, 0x0001500064601e6c,
+    0x0001500064c0021a, 0x0001500064e00162, 0x0001500065a01e70, 0x0001500066201e6e,
+    0x00015400600000d9, 0x00015400602000da, 0x00015400604000db, 0x0001540060600168,
+    0x000154006080016a, 0x0001540060c0016c, 0x00015400610000dc, 0x0001540061201ee6,
+    0x000154006140016e, 0x0001540061600170, 0x00015400618001d3, 0x0001540061e00214,
+    0x0001540062200216, 0x00015400636001af, 0x0001540064601ee4, 0x0001540064801e72,
+    0x0001540065000172, 0x0001540065a01e76, 0x0001540066001e74, 0x0001580060601e7c,
+    0x0001580064601e7e, 0x00015c0060001e80, 0x00015c0060201e82, 0x00015c0060400174,
+    0x00015c0060e01e86, 0x00015c0061001e84, 0x00015c0064601e88, 0x0001600060e01e8a,
+    0x0001600061001e8c, 0x0001640060001ef2, 0x00016400602000dd, 0x0001640060400176,
+    0x0001640060601ef8, 0x0001640060800232, 0x0001640060e01e8e, 0x0001640061000178,
+    0x0001640061201ef6, 0x0001640064601ef4, 0x0001680060200179, 0x0001680060401e90,
+    0x0001680060e0017b, 0x000168006180017d, 0x0001680064601e92, 0x0001680066201e94,
+    0x00018400600000e0, 0x00018400602000e1, 0x00018400604000e2, 0x00018400606000e3,
+    0x0001840060800101, 0x0001840060c00103, 0x0001840060e00227, 0x00018400610000e4,
+    0x0001840061201ea3, 0x00018400614000e5, 0x00018400618001ce, 0x0001840061e00201,
+    0x0001840062200203, 0x0001840064601ea1, 0x0001840064a01e01, 0x0001840065000105,
+    0x0001880060e01e03, 0x0001880064601e05, 0x0001880066201e07, 0x00018c0060200107,
+    0x00018c0060400109, 0x00018c0060e0010b, 0x00018c006180010d, 0x00018c0064e000e7,
+    0x0001900060e01e0b, 0x000190006180010f, 0x0001900064601e0d, 0x0001900064e01e11,
+    0x0001900065a01e13, 0x0001900066201e0f, 0x00019400600000e8, 0x00019400602000e9,
+    0x00019400604000ea, 0x0001940060601ebd, 0x0001940060800113, 0x0001940060c00115,
+    0x0001940060e00117, 0x00019400610000eb, 0x0001940061201ebb, 0x000194006180011b,
+    0x0001940061e00205, 0x0001940062200207, 0x0001940064601eb9, 0x0001940064e00229,
+    0x0001940065000119, 0x0001940065a01e19, 0x0001940066001e1b, 0x0001980060e01e1f,
+    0x00019c00602001f5, 0x00019c006040011d, 0x00019c0060801e21, 0x00019c0060c0011f,
+    0x00019c0060e00121, 0x00019c00618001e7, 0x00019c0064e00123, 0x0001a00060400125,
+    0x0001a00060e01e23, 0x0001a00061001e27, 0x0001a0006180021f, 0x0001a00064601e25,
+    0x0001a00064e01e29, 0x0001a00065c01e2b, 0x0001a00066201e96, 0x0001a400600000ec,
+    0x0001a400602000ed, 0x0001a400604000ee, 0x0001a40060600129, 0x0001a4006080012b,
+    0x0001a40060c0012d, 0x0001a400610000ef, 0x0001a40061201ec9, 0x0001a400618001d0,
+    0x0001a40061e00209, 0x0001a4006220020b, 0x0001a40064601ecb, 0x0001a4006500012f,
+    0x0001a40066001e2d, 0x0001a80060400135, 0x0001a800618001f0, 0x0001ac0060201e31,
+    0x0001ac00618001e9, 0x0001ac0064601e33, 0x0001ac0064e00137, 0x0001ac0066201e35,
+    0x0001b0006020013a, 0x0001b0006180013e, 0x0001b00064601e37, 0x0001b00064e0013c,
+    0x0001b00065a01e3d, 0x0001b00066201e3b, 0x0001b40060201e3f, 0x0001b40060e01e41,
+    0x0001b40064601e43, 0x0001b800600001f9, 0x0001b80060200144, 0x0001b800606000f1,
+    0x0001b80060e01e45, 0x0001b80061800148, 0x0001b80064601e47, 0x0001b80064e00146,
+    0x0001b80065a01e4b, 0x0001b80066201e49, 0x0001bc00600000f2, 0x0001bc00602000f3,
+    0x0001bc00604000f4, 0x0001bc00606000f5, 0x0001bc006080014d, 0x0001bc0060c0014f,
+    0x0001bc0060e0022f, 0x0001bc00610000f6, 0x0001bc0061201ecf, 0x0001bc0061600151,
+    0x0001bc00618001d2, 0x0001bc0061e0020d, 0x0001bc006220020f, 0x0001bc00636001a1,
+    0x0001bc0064601ecd, 0x0001bc00650001eb, 0x0001c00060201e55, 0x0001c00060e01e57,
+    0x0001c80060200155, 0x0001c80060e01e59, 0x0001c80061800159, 0x0001c80061e00211,
+    0x0001c80062200213, 0x0001c80064601e5b, 0x0001c80064e00157, 0x0001c80066201e5f,
+    0x0001cc006020015b, 0x0001cc006040015d, 0x0001cc0060e01e61, 0x0001cc0061800161,
+    0x0001cc0064601e63, 0x0001cc0064c00219, 0x0001cc0064e0015f, 0x0001d00060e01e6b,
+    0x0001d00061001e97, 0x0001d00061800165, 0x0001d00064601e6d, 0x0001d00064c0021b,
+    0x0001d00064e00163, 0x0001d00065a01e71, 0x0001d00066201e6f, 0x0001d400600000f9,
+    0x0001d400602000fa, 0x0001d400604000fb, 0x0001d40060600169, 0x0001d4006080016b,
+    0x0001d40060c0016d, 0x0001d400610000fc, 0x0001d40061201ee7, 0x0001d4006140016f,
+    0x0001d40061600171, 0x0001d400618001d4, 0x0001d40061e00215, 0x0001d40062200217,
+    0x0001d400636001b0, 0x0001d40064601ee5, 0x0001d40064801e73, 0x0001d40065000173,
+    0x0001d40065a01e77, 0x0001d40066001e75, 0x0001d80060601e7d, 0x0001d80064601e7f,
+    0x0001dc0060001e81, 0x0001dc0060201e83, 0x0001dc0060400175, 0x0001dc0060e01e87,
+    0x0001dc0061001e85, 0x0001dc0061401e98, 0x0001dc0064601e89, 0x0001e00060e01e8b,
+    0x0001e00061001e8d, 0x0001e40060001ef3, 0x0001e400602000fd, 0x0001e40060400177,
+    0x0001e40060601ef9, 0x0001e40060800233, 0x0001e40060e01e8f, 0x0001e400610000ff,
+    0x0001e40061201ef7, 0x0001e40061401e99, 0x0001e40064601ef5, 0x0001e8006020017a,
+    0x0001e80060401e91, 0x0001e80060e0017c, 0x0001e8006180017e, 0x0001e80064601e93,
+    0x0001e80066201e95, 0x0002a00060001fed, 0x0002a00060200385, 0x0002a00068401fc1,
+    0x0003080060001ea6, 0x0003080060201ea4, 0x0003080060601eaa, 0x0003080061201ea8,
+    0x00031000608001de, 0x00031400602001fa, 0x00031800602001fc, 0x00031800608001e2,
+    0x00031c0060201e08, 0x0003280060001ec0, 0x0003280060201ebe, 0x0003280060601ec4,
+    0x0003280061201ec2, 0x00033c0060201e2e, 0x0003500060001ed2, 0x0003500060201ed0,
+    0x0003500060601ed6, 0x0003500061201ed4, 0x0003540060201e4c, 0x000354006080022c,
+    0x0003540061001e4e, 0x000358006080022a, 0x00036000602001fe, 0x00037000600001db,
+    0x00037000602001d7, 0x00037000608001d5, 0x00037000618001d9, 0x0003880060001ea7,
+    0x0003880060201ea5, 0x0003880060601eab, 0x0003880061201ea9, 0x00039000608001df,
+    0x00039400602001fb, 0x00039800602001fd, 0x00039800608001e3, 0x00039c0060201e09,
+    0x0003a80060001ec1, 0x0003a80060201ebf, 0x0003a80060601ec5, 0x0003a80061201ec3,
+    0x0003bc0060201e2f, 0x0003d00060001ed3, 0x0003d00060201ed1, 0x0003d00060601ed7,
+    0x0003d00061201ed5, 0x0003d40060201e4d, 0x0003d4006080022d, 0x0003d40061001e4f,
+    0x0003d8006080022b, 0x0003e000602001ff, 0x0003f000600001dc, 0x0003f000602001d8,
+    0x0003f000608001d6, 0x0003f000618001da, 0x0004080060001eb0, 0x0004080060201eae,
+    0x0004080060601eb4, 0x0004080061201eb2, 0x00040c0060001eb1, 0x00040c0060201eaf,
+    0x00040c0060601eb5, 0x00040c0061201eb3, 0x0004480060001e14, 0x0004480060201e16,
+    0x00044c0060001e15, 0x00044c0060201e17, 0x0005300060001e50, 0x0005300060201e52,
+    0x0005340060001e51, 0x0005340060201e53, 0x0005680060e01e64, 0x00056c0060e01e65,
+    0x0005800060e01e66, 0x0005840060e01e67, 0x0005a00060201e78, 0x0005a40060201e79,
+    0x0005a80061001e7a, 0x0005ac0061001e7b, 0x0005fc0060e01e9b, 0x0006800060001edc,
+    0x0006800060201eda, 0x0006800060601ee0, 0x0006800061201ede, 0x0006800064601ee2,
+    0x0006840060001edd, 0x0006840060201edb, 0x0006840060601ee1, 0x0006840061201edf,
+    0x0006840064601ee3, 0x0006bc0060001eea, 0x0006bc0060201ee8, 0x0006bc0060601eee,
+    0x0006bc0061201eec, 0x0006bc0064601ef0, 0x0006c00060001eeb, 0x0006c00060201ee9,
+    0x0006c00060601eef, 0x0006c00061201eed, 0x0006c00064601ef1, 0x0006dc00618001ee,
+    0x0007a800608001ec, 0x0007ac00608001ed, 0x00089800608001e0, 0x00089c00608001e1,
+    0x0008a00060c01e1c, 0x0008a40060c01e1d, 0x0008b80060800230, 0x0008bc0060800231,
+    0x000a4800618001ef, 0x000e440060001fba, 0x000e440060200386, 0x000e440060801fb9,
+    0x000e440060c01fb8, 0x000e440062601f08, 0x000e440062801f09, 0x000e440068a01fbc,
+    0x000e540060001fc8, 0x000e540060200388, 0x000e540062601f18, 0x000e540062801f19,
+    0x000e5c0060001fca, 0x000e5c0060200389, 0x000e5c0062601f28, 0x000e5c0062801f29,
+    0x000e5c0068a01fcc, 0x000e640060001fda, 0x000e64006020038a, 0x000e640060801fd9,
+    0x000e640060c01fd8, 0x000e6400610003aa, 0x000e640062601f38, 0x000e640062801f39,
+    0x000e7c0060001ff8, 0x000e7c006020038c, 0x000e7c0062601f48, 0x000e7c0062801f49,
+    0x000e840062801fec, 0x000e940060001fea, 0x000e94006020038e, 0x000e940060801fe9,
+    0x000e940060c01fe8, 0x000e9400610003ab, 0x000e940062801f59, 0x000ea40060001ffa,
+    0x000ea4006020038f, 0x000ea40062601f68, 0x000ea40062801f69, 0x000ea40068a01ffc,
+    0x000eb00068a01fb4, 0x000eb80068a01fc4, 0x000ec40060001f70, 0x000ec400602003ac,
+    0x000ec40060801fb1, 0x000ec40060c01fb0, 0x000ec40062601f00, 0x000ec40062801f01,
+    0x000ec40068401fb6, 0x000ec40068a01fb3, 0x000ed40060001f72, 0x000ed400602003ad,
+    0x000ed40062601f10, 0x000ed40062801f11, 0x000edc0060001f74, 0x000edc00602003ae,
+    0x000edc0062601f20, 0x000edc0062801f21, 0x000edc0068401fc6, 0x000edc0068a01fc3,
+    0x000ee40060001f76, 0x000ee400602003af, 0x000ee40060801fd1, 0x000ee40060c01fd0,
+    0x000ee400610003ca, 0x000ee40062601f30, 0x000ee40062801f31, 0x000ee40068401fd6,
+    0x000efc0060001f78, 0x000efc00602003cc, 0x000efc0062601f40, 0x000efc0062801f41,
+    0x000f040062601fe4, 0x000f040062801fe5, 0x000f140060001f7a, 0x000f1400602003cd,
+    0x000f140060801fe1, 0x000f140060c01fe0, 0x000f1400610003cb, 0x000f140062601f50,
+    0x000f140062801f51, 0x000f140068401fe6, 0x000f240060001f7c, 0x000f2400602003ce,
+    0x000f240062601f60, 0x000f240062801f61, 0x000f240068401ff6, 0x000f240068a01ff3,
+    0x000f280060001fd2, 0x000f280060200390, 0x000f280068401fd7, 0x000f2c0060001fe2,
+    0x000f2c00602003b0, 0x000f2c0068401fe7, 0x000f380068a01ff4, 0x000f4800602003d3,
+    0x000f4800610003d4, 0x0010180061000407, 0x0010400060c004d0, 0x00104000610004d2,
+    0x00104c0060200403, 0x0010540060000400, 0x0010540060c004d6, 0x0010540061000401,
+    0x0010580060c004c1, 0x00105800610004dc, 0x00105c00610004de, 0x001060006000040d,
+    0x00106000608004e2, 0x0010600060c00419, 0x00106000610004e4, 0x001068006020040c,
+    0x00107800610004e6, 0x00108c00608004ee, 0x00108c0060c0040e, 0x00108c00610004f0,
+    0x00108c00616004f2, 0x00109c00610004f4, 0x0010ac00610004f8, 0x0010b400610004ec,
+    0x0010c00060c004d1, 0x0010c000610004d3, 0x0010cc0060200453, 0x0010d40060000450,
+    0x0010d40060c004d7, 0x0010d40061000451, 0x0010d80060c004c2, 0x0010d800610004dd,
+    0x0010dc00610004df, 0x0010e0006000045d, 0x0010e000608004e3, 0x0010e00060c00439,
+    0x0010e000610004e5, 0x0010e8006020045c, 0x0010f800610004e7, 0x00110c00608004ef,
+    0x00110c0060c0045e, 0x00110c00610004f1, 0x00110c00616004f3, 0x00111c00610004f5,
+    0x00112c00610004f9, 0x00113400610004ed, 0x0011580061000457, 0x0011d00061e00476,
+    0x0011d40061e00477, 0x00136000610004da, 0x00136400610004db, 0x0013a000610004ea,
+    0x0013a400610004eb, 0x00189c00ca600622, 0x00189c00ca800623, 0x00189c00caa00625,
+    0x00192000ca800624, 0x00192800ca800626, 0x001b0400ca8006c2, 0x001b4800ca8006d3,
+    0x001b5400ca8006c0, 0x0024a00127800929, 0x0024c00127800931, 0x0024cc0127800934,
+    0x00271c0137c009cb, 0x00271c013ae009cc, 0x002d1c0167c00b4b, 0x002d1c016ac00b48,
+    0x002d1c016ae00b4c, 0x002e48017ae00b94, 0x002f180177c00bca, 0x002f18017ae00bcc,
+    0x002f1c0177c00bcb, 0x003118018ac00c48, 0x0032fc019aa00cc0, 0x0033180198400cca,
+    0x003318019aa00cc7, 0x003318019ac00cc8, 0x003328019aa00ccb, 0x00351801a7c00d4a,
+    0x00351801aae00d4c, 0x00351c01a7c00d4b, 0x00376401b9400dda, 0x00376401b9e00ddc,
+    0x00376401bbe00dde, 0x00377001b9400ddd, 0x0040940205c01026, 0x006c140366a01b06,
+    0x006c1c0366a01b08, 0x006c240366a01b0a, 0x006c2c0366a01b0c, 0x006c340366a01b0e,
+    0x006c440366a01b12, 0x006ce80366a01b3b, 0x006cf00366a01b3d, 0x006cf80366a01b40,
+    0x006cfc0366a01b41, 0x006d080366a01b43, 0x0078d80060801e38, 0x0078dc0060801e39,
+    0x0079680060801e5c, 0x00796c0060801e5d, 0x0079880060e01e68, 0x00798c0060e01e69,
+    0x007a800060401eac, 0x007a800060c01eb6, 0x007a840060401ead, 0x007a840060c01eb7,
+    0x007ae00060401ec6, 0x007ae40060401ec7, 0x007b300060401ed8, 0x007b340060401ed9,
+    0x007c000060001f02, 0x007c000060201f04, 0x007c000068401f06, 0x007c000068a01f80,
+    0x007c040060001f03, 0x007c040060201f05, 0x007c040068401f07, 0x007c040068a01f81,
+    0x007c080068a01f82, 0x007c0c0068a01f83, 0x007c100068a01f84, 0x007c140068a01f85,
+    0x007c180068a01f86, 0x007c1c0068a01f87, 0x007c200060001f0a, 0x007c200060201f0c,
+    0x007c200068401f0e, 0x007c200068a01f88, 0x007c240060001f0b, 0x007c240060201f0d,
+    0x007c240068401f0f, 0x007c240068a01f89, 0x007c280068a01f8a, 0x007c2c0068a01f8b,
+    0x007c300068a01f8c, 0x007c340068a01f8d, 0x007c380068a01f8e, 0x007c3c0068a01f8f,
+    0x007c400060001f12, 0x007c400060201f14, 0x007c440060001f13, 0x007c440060201f15,
+    0x007c600060001f1a, 0x007c600060201f1c, 0x007c640060001f1b, 0x007c640060201f1d,
+    0x007c800060001f22, 0x007c800060201f24, 0x007c800068401f26, 0x007c800068a01f90,
+    0x007c840060001f23, 0x007c840060201f25, 0x007c840068401f27, 0x007c840068a01f91,
+    0x007c880068a01f92, 0x007c8c0068a01f93, 0x007c900068a01f94, 0x007c940068a01f95,
+    0x007c980068a01f96, 0x007c9c0068a01f97, 0x007ca00060001f2a, 0x007ca00060201f2c,
+    0x007ca00068401f2e, 0x007ca00068a01f98, 0x007ca40060001f2b, 0x007ca40060201f2d,
+    0x007ca40068401f2f, 0x007ca40068a01f99, 0x007ca80068a01f9a, 0x007cac0068a01f9b,
+    0x007cb00068a01f9c, 0x007cb40068a01f9d, 0x007cb80068a01f9e, 0x007cbc0068a01f9f,
+    0x007cc00060001f32, 0x007cc00060201f34, 0x007cc00068401f36, 0x007cc40060001f33,
+    0x007cc40060201f35, 0x007cc40068401f37, 0x007ce00060001f3a, 0x007ce00060201f3c,
+    0x007ce00068401f3e, 0x007ce40060001f3b, 0x007ce40060201f3d, 0x007ce40068401f3f,
+    0x007d000060001f42, 0x007d000060201f44, 0x007d040060001f43, 0x007d040060201f45,
+    0x007d200060001f4a, 0x007d200060201f4c, 0x007d240060001f4b, 0x007d240060201f4d,
+    0x007d400060001f52, 0x007d400060201f54, 0x007d400068401f56, 0x007d440060001f53,
+    0x007d440060201f55, 0x007d440068401f57, 0x007d640060001f5b, 0x007d640060201f5d,
+    0x007d640068401f5f, 0x007d800060001f62, 0x007d800060201f64, 0x007d800068401f66,
+    0x007d800068a01fa0, 0x007d840060001f63, 0x007d840060201f65, 0x007d840068401f67,
+    0x007d840068a01fa1, 0x007d880068a01fa2, 0x007d8c0068a01fa3, 0x007d900068a01fa4,
+    0x007d940068a01fa5, 0x007d980068a01fa6, 0x007d9c0068a01fa7, 0x007da00060001f6a,
+    0x007da00060201f6c, 0x007da00068401f6e, 0x007da00068a01fa8, 0x007da40060001f6b,
+    0x007da40060201f6d, 0x007da40068401f6f, 0x007da40068a01fa9, 0x007da80068a01faa,
+    0x007dac0068a01fab, 0x007db00068a01fac, 0x007db40068a01fad, 0x007db80068a01fae,
+    0x007dbc0068a01faf, 0x007dc00068a01fb2, 0x007dd00068a01fc2, 0x007df00068a01ff2,
+    0x007ed80068a01fb7, 0x007efc0060001fcd, 0x007efc0060201fce, 0x007efc0068401fcf,
+    0x007f180068a01fc7, 0x007fd80068a01ff7, 0x007ff80060001fdd, 0x007ff80060201fde,
+    0x007ff80068401fdf, 0x008640006700219a, 0x008648006700219b, 0x00865000670021ae,
+    0x00874000670021cd, 0x00874800670021cf, 0x00875000670021ce, 0x00880c0067002204,
+    0x0088200067002209, 0x00882c006700220c, 0x00888c0067002224, 0x0088940067002226,
+    0x0088f00067002241, 0x00890c0067002244, 0x0089140067002247, 0x0089200067002249,
+    0x008934006700226d, 0x0089840067002262, 0x0089900067002270, 0x0089940067002271,
+    0x0089c80067002274, 0x0089cc0067002275, 0x0089d80067002278, 0x0089dc0067002279,
+    0x0089e80067002280, 0x0089ec0067002281, 0x0089f000670022e0, 0x0089f400670022e1,
+    0x008a080067002284, 0x008a0c0067002285, 0x008a180067002288, 0x008a1c0067002289,
+    0x008a4400670022e2, 0x008a4800670022e3, 0x008a8800670022ac, 0x008aa000670022ad,
+    0x008aa400670022ae, 0x008aac00670022af, 0x008ac800670022ea, 0x008acc00670022eb,
+    0x008ad000670022ec, 0x008ad400670022ed, 0x00c1180613203094, 0x00c12c061320304c,
+    0x00c134061320304e, 0x00c13c0613203050, 0x00c1440613203052, 0x00c14c0613203054,
+    0x00c1540613203056, 0x00c15c0613203058, 0x00c164061320305a, 0x00c16c061320305c,
+    0x00c174061320305e, 0x00c17c0613203060, 0x00c1840613203062, 0x00c1900613203065,
+    0x00c1980613203067, 0x00c1a00613203069, 0x00c1bc0613203070, 0x00c1bc0613403071,
+    0x00c1c80613203073, 0x00c1c80613403074, 0x00c1d40613203076, 0x00c1d40613403077,
+    0x00c1e00613203079, 0x00c1e0061340307a, 0x00c1ec061320307c, 0x00c1ec061340307d,
+    0x00c274061320309e, 0x00c29806132030f4, 0x00c2ac06132030ac, 0x00c2b406132030ae,
+    0x00c2bc06132030b0, 0x00c2c406132030b2, 0x00c2cc06132030b4, 0x00c2d406132030b6,
+    0x00c2dc06132030b8, 0x00c2e406132030ba, 0x00c2ec06132030bc, 0x00c2f406132030be,
+    0x00c2fc06132030c0, 0x00c30406132030c2, 0x00c31006132030c5, 0x00c31806132030c7,
+    0x00c32006132030c9, 0x00c33c06132030d0, 0x00c33c06134030d1, 0x00c34806132030d3,
+    0x00c34806134030d4, 0x00c35406132030d6, 0x00c35406134030d7, 0x00c36006132030d9,
+    0x00c36006134030da, 0x00c36c06132030dc, 0x00c36c06134030dd, 0x00c3bc06132030f7,
+    0x00c3c006132030f8, 0x00c3c406132030f9, 0x00c3c806132030fa, 0x00c3f406132030fe,
+    0x044264221741109a, 0x04426c221741109c, 0x04429422174110ab, 0x0444c42224e1112e,
+    0x0444c82224e1112f, 0x044d1c2267c1134b, 0x044d1c226ae1134c, 0x0452e422960114bc,
+    0x0452e422974114bb, 0x0452e42297a114be, 0x0456e022b5e115ba, 0x0456e422b5e115bb,
+    0x0464d42326011938,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// grapheme cluster break in bits 0-3, extended pictographic in bit 4, width in bits 5-6, 12896 bytes
+
+inline constexpr std::uint8_t grapheme_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 31, 32, 33,
+    34, 35, 36, 37, 31, 32, 33, 34, 35, 36, 37, 38, 39, 39, 39, 39,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 40, 41, 10, 42,
+    43, 44, 10, 10, 10, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 56, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 57, 10, 58, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 59, 25, 25, 60, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 61, 62, 63, 10, 10, 10, 10, 64, 10,
+    10, 10, 10, 10, 10, 10, 10, 65, 66, 67, 10, 10, 10, 68, 10, 10,
+    69, 70, 10, 10, 71, 10, 10, 10, 72, 73, 74, 75, 76, 77, 78, 79,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 80,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 80,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    81, 82, 82, 82, 82, 82, 82, 82, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+inline constexpr std::uint16_t grapheme_stage2[] = {
+    0, 1, 2, 2, 2, 2, 2, 3, 1, 1, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 5, 8, 9, 2, 2, 2,
+    10, 11, 2, 2, 12, 5, 2, 13, 2, 2, 2, 2, 2, 14, 15, 2,
+    16, 17, 2, 5, 18, 2, 2, 2, 2, 2, 19, 13, 2, 2, 12, 20,
+    2, 21, 22, 2, 2, 23, 2, 2, 2, 24, 2, 2, 25, 5, 26, 5,
+    27, 2, 2, 28, 29, 30, 31, 2, 32, 2, 2, 33, 34, 35, 31, 36,
+    37, 2, 2, 38, 39, 17, 2, 40, 37, 2, 2, 38, 41, 2, 31, 25,
+    32, 2, 2, 42, 34, 43, 31, 2, 44, 2, 2, 45, 46, 35, 2, 2,
+    47, 2, 2, 48, 49, 50, 31, 2, 32, 2, 2, 51, 52, 53, 31, 2,
+    54, 2, 2, 55, 56, 35, 31, 2, 32, 2, 2, 2, 57, 58, 2, 59,
+    2, 2, 2, 60, 61, 2, 2, 2, 2, 2, 2, 62, 63, 2, 2, 2,
+    2, 64, 2, 65, 2, 2, 2, 66, 67, 68, 5, 69, 70, 2, 2, 2,
+    2, 2, 71, 72, 2, 73, 13, 74, 75, 76, 2, 2, 2, 2, 2, 2,
+    77, 77, 77, 77, 77, 77, 78, 78, 78, 78, 79, 80, 80, 80, 80, 80,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 71, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 81, 2, 82, 2, 31, 2, 31, 2, 2, 2, 83, 84, 20, 2, 2,
+    85, 2, 2, 2, 2, 2, 2, 2, 50, 2, 86, 2, 2, 2, 2, 2,
+    2, 2, 87, 88, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 89, 2, 2, 2, 90, 91, 92, 2, 2, 2, 5, 93, 2, 2, 2,
+    94, 2, 2, 95, 96, 2, 12, 97, 98, 2, 99, 2, 2, 2, 100, 54,
+    2, 2, 101, 102, 2, 2, 2, 2, 2, 2, 2, 2, 2, 103, 104, 105,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
+    106, 2, 107, 108, 109, 2, 110, 2, 2, 2, 2, 2, 2, 5, 5, 13,
+    2, 2, 111, 109, 2, 2, 2, 2, 2, 112, 113, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 114, 115, 2, 2, 2, 2, 2, 116, 2, 2, 2, 117, 2, 118, 119,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 120, 121, 122, 2, 2, 123,
+    124, 125, 126, 126, 127, 128, 126, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+    138, 139, 140, 141, 142, 143, 144, 2, 2, 145, 146, 147, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 148, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    149, 150, 2, 2, 2, 151, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 152, 153,
+    2, 2, 2, 2, 2, 2, 2, 152, 2, 2, 2, 2, 2, 2, 5, 5,
+    2, 2, 2, 2, 2, 2, 2, 2, 154, 155, 154, 154, 154, 154, 154, 156,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 157, 2, 158,
+    154, 154, 159, 160, 161, 154, 154, 154, 154, 162, 154, 154, 154, 154, 154, 154,
+    163, 154, 154, 161, 154, 154, 154, 154, 164, 154, 154, 154, 154, 154, 156, 154,
+    154, 164, 154, 154, 165, 154, 154, 154, 154, 166, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 2, 2, 2, 2,
+    154, 154, 154, 154, 154, 154, 154, 154, 167, 154, 154, 154, 168, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 152, 169, 2, 170, 2, 2, 2, 2, 2, 153,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    171, 2, 172, 2, 2, 2, 2, 2, 173, 2, 2, 174, 175, 2, 5, 176,
+    2, 2, 177, 2, 178, 54, 77, 179, 27, 2, 2, 180, 181, 2, 182, 2,
+    2, 2, 183, 184, 185, 2, 2, 186, 2, 2, 2, 187, 17, 2, 188, 189,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 190, 2,
+    191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192,
+    193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194,
+    193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195,
+    193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191,
+    192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193,
+    194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193,
+    195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193,
+    191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192,
+    193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194,
+    193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195,
+    193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191,
+    192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193,
+    194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193,
+    195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193,
+    191, 192, 193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 195, 193, 191, 192,
+    193, 194, 193, 195, 193, 191, 192, 193, 194, 193, 196, 78, 197, 80, 80, 198,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    2, 36, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 200, 5, 154, 154, 201, 202, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    161, 154, 154, 154, 154, 154, 203, 2, 2, 204, 2, 2, 2, 2, 168, 205,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 76,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2,
+    2, 2, 2, 2, 2, 2, 2, 206, 2, 2, 2, 2, 2, 2, 2, 2,
+    207, 2, 2, 208, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 50, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 209, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 210, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19, 13, 2, 2, 211, 2, 2, 2, 2, 2, 2, 2,
+    212, 2, 2, 213, 214, 2, 2, 215, 98, 2, 2, 216, 217, 2, 2, 2,
+    218, 2, 219, 220, 221, 2, 2, 222, 98, 2, 2, 223, 224, 2, 2, 2,
+    2, 2, 225, 226, 2, 2, 2, 2, 2, 2, 2, 2, 2, 152, 227, 2,
+    54, 2, 2, 55, 228, 35, 229, 220, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 230, 231, 36, 2, 2, 2, 2, 2, 232, 233, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 234, 235, 13, 236, 2, 2,
+    2, 2, 2, 237, 13, 2, 2, 2, 2, 2, 238, 239, 2, 2, 2, 2,
+    2, 71, 240, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 225, 241, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 242, 243, 2, 2, 2, 2, 2, 2, 2, 2, 244, 245, 2,
+    246, 2, 2, 247, 248, 249, 2, 2, 250, 251, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 252, 253, 2, 2, 2, 2, 2, 254, 255, 256, 2, 2, 2, 2,
+    2, 2, 2, 257, 258, 2, 2, 2, 259, 260, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 261,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 262, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 220,
+    2, 2, 2, 214, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 152, 263, 264, 264, 265, 218, 2, 2, 2, 2, 266, 267,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 165,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 157, 2, 2,
+    268, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 269,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 270, 2, 2, 270, 271, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 158,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 272, 273, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 274, 5, 214, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 275, 276, 277, 2, 278, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 279, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 280, 5, 5, 69, 182, 281, 12, 7, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    282, 283, 284, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 214, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2, 2, 285, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 214, 2, 2,
+    2, 2, 2, 2, 286, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    135, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 129, 126, 126, 126,
+    287, 2, 117, 2, 2, 2, 288, 289, 290, 291, 287, 126, 126, 126, 292, 293,
+    294, 295, 296, 297, 298, 299, 300, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    301, 301, 302, 303, 301, 301, 301, 304, 301, 128, 301, 301, 305, 128, 301, 306,
+    301, 301, 301, 307, 308, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 309,
+    301, 301, 301, 310, 311, 301, 312, 136, 126, 313, 135, 126, 126, 126, 126, 314,
+    301, 301, 301, 301, 301, 2, 2, 2, 301, 301, 301, 301, 315, 316, 317, 318,
+    2, 2, 2, 2, 2, 2, 2, 319, 2, 2, 2, 2, 2, 320, 321, 322,
+    288, 2, 2, 2, 323, 324, 2, 2, 323, 2, 325, 126, 126, 126, 126, 126,
+    326, 301, 301, 327, 328, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301,
+    126, 126, 126, 126, 126, 126, 126, 329, 330, 301, 331, 332, 300, 333, 312, 330,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 334,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 335,
+    336, 337, 5, 5, 5, 5, 5, 5, 337, 337, 337, 337, 337, 337, 337, 337,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 337,
+    337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337,
+    337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337, 337,
+};
+
+inline constexpr std::uint8_t grapheme_data[] = {
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 3,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32, 32, 35, 48, 32,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32,
+    32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 4,
+    32, 4, 4, 32, 4, 4, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    7, 7, 7, 7, 7, 7, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 3, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4,
+    4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 7, 32, 4,
+    4, 4, 4, 4, 4, 32, 32, 4, 4, 32, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 7,
+    32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 32, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 32, 4, 4, 4, 32, 4, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 32, 32, 32, 32,
+    7, 7, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4,
+    4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 40, 4, 32, 40, 40,
+    40, 4, 4, 4, 4, 4, 4, 4, 4, 40, 40, 40, 40, 4, 40, 40,
+    32, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 4, 40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 36, 40,
+    40, 4, 4, 4, 4, 32, 32, 40, 40, 32, 32, 40, 40, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 36, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32,
+    32, 4, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 40, 40,
+    40, 4, 4, 32, 32, 32, 32, 4, 4, 32, 32, 4, 4, 4, 32, 32,
+    4, 4, 32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    40, 4, 4, 4, 4, 4, 32, 4, 4, 40, 32, 40, 40, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 36, 4,
+    32, 32, 32, 32, 32, 4, 4, 36, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 36, 40,
+    4, 40, 40, 32, 32, 32, 40, 40, 40, 32, 40, 40, 40, 4, 32, 32,
+    4, 40, 40, 40, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 4, 4,
+    4, 40, 40, 40, 40, 32, 4, 4, 4, 32, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 40, 4,
+    40, 40, 36, 40, 40, 32, 4, 40, 40, 32, 40, 40, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 36, 36, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 32, 36, 40,
+    40, 4, 4, 4, 4, 32, 40, 40, 40, 32, 40, 40, 40, 4, 39, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 32, 32, 32, 36,
+    40, 40, 4, 4, 4, 32, 4, 32, 40, 40, 40, 40, 40, 40, 40, 36,
+    32, 32, 40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 4, 32, 40, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 32,
+    32, 4, 32, 40, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 4, 32, 4, 32, 4, 32, 32, 32, 32, 40, 40,
+    32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 40,
+    4, 4, 4, 4, 4, 32, 4, 4, 32, 32, 32, 32, 32, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 32, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4,
+    4, 40, 4, 4, 4, 4, 4, 4, 32, 4, 4, 40, 40, 4, 4, 32,
+    32, 32, 32, 32, 32, 32, 40, 40, 4, 4, 32, 32, 32, 32, 4, 4,
+    32, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 4, 32, 40, 4, 4, 32, 32, 32, 32, 32, 32, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 32,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    32, 32, 4, 4, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 4, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 4, 4, 40, 4, 4, 4, 4, 4, 4, 4, 40, 40,
+    40, 40, 40, 40, 40, 40, 4, 40, 40, 4, 4, 4, 4, 4, 4, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 3, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 40, 40, 40, 40, 4, 4, 40, 40, 40, 32, 32, 32, 32,
+    40, 40, 4, 40, 40, 40, 40, 40, 40, 4, 4, 4, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 4, 4, 40, 40, 4, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 40, 4, 40, 4, 4, 4, 4, 4, 4, 4, 32,
+    4, 32, 4, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 40, 40, 40,
+    40, 40, 40, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32,
+    4, 4, 4, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 4, 36, 4, 4, 4, 4, 4, 40, 4, 40, 40, 40,
+    40, 40, 4, 40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 40, 4, 4, 4, 4, 40, 40, 4, 4, 40, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 4, 40, 4, 4, 40, 40, 40, 4, 40, 4,
+    32, 32, 32, 32, 40, 40, 40, 40, 40, 40, 40, 40, 4, 4, 4, 4,
+    4, 4, 4, 4, 40, 40, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 40, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 4, 32, 32,
+    32, 32, 32, 32, 4, 32, 32, 40, 4, 4, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 3, 4, 5, 3, 3,
+    32, 32, 32, 32, 32, 32, 32, 32, 3, 3, 3, 3, 3, 3, 3, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32, 32, 32, 32, 32,
+    3, 3, 3, 3, 3, 35, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    32, 32, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 80, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 48, 64, 64, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 80, 80, 80, 48, 48, 48,
+    80, 48, 48, 80, 32, 32, 32, 32, 48, 48, 48, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 80, 80, 32,
+    48, 48, 48, 48, 48, 48, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 32, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 80,
+    48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    48, 48, 48, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 80, 48, 48, 48, 48, 48, 48, 48, 48, 80, 80, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 80, 80, 48,
+    48, 48, 48, 48, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 80, 48,
+    48, 48, 48, 48, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 80, 48, 48, 48, 48, 48,
+    48, 48, 80, 80, 48, 80, 48, 48, 48, 48, 80, 48, 48, 80, 48, 48,
+    48, 48, 48, 48, 48, 80, 32, 32, 48, 48, 80, 80, 48, 48, 48, 48,
+    48, 48, 48, 32, 48, 32, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32,
+    32, 48, 32, 32, 32, 32, 32, 32, 80, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 32, 32, 80, 32, 80, 32,
+    32, 32, 32, 80, 80, 80, 32, 80, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 80, 80, 80, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    80, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80,
+    32, 32, 32, 32, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 80, 32, 32, 32,
+    80, 32, 32, 32, 32, 80, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4,
+    4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 4, 4, 4, 4, 68, 68,
+    80, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 80, 64, 32,
+    32, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 32, 32, 4, 4, 64, 64, 64, 64, 64,
+    32, 32, 32, 32, 32, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32,
+    64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 80, 64, 80, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4,
+    32, 32, 4, 32, 32, 32, 4, 32, 32, 32, 32, 4, 32, 32, 32, 32,
+    32, 32, 32, 40, 40, 4, 4, 40, 32, 32, 32, 32, 4, 32, 32, 32,
+    40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4,
+    32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 32, 32, 32,
+    32, 32, 32, 4, 40, 40, 4, 4, 4, 4, 40, 40, 4, 4, 40, 40,
+    40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 40,
+    40, 4, 4, 40, 40, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 4, 40, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 32, 32, 32,
+    4, 32, 4, 4, 4, 32, 32, 4, 4, 32, 32, 32, 32, 32, 4, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 4, 4, 40, 40,
+    32, 32, 32, 32, 32, 40, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 40, 40, 4, 40, 40, 4, 40, 40, 32, 40, 4, 32, 32,
+    76, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 76, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 76, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 76, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    10, 10, 10, 10, 10, 10, 10, 32, 32, 32, 32, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 32, 32, 32, 32,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 32, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 32, 64, 64, 64, 64, 32, 32, 32, 32,
+    64, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 36, 36,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 3, 3, 3, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    32, 4, 4, 4, 32, 4, 4, 32, 32, 32, 32, 32, 4, 4, 4, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 32, 32, 32, 32, 4,
+    32, 32, 32, 32, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 32, 32, 32,
+    32, 32, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    40, 4, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 32, 32, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4,
+    40, 40, 40, 4, 4, 4, 4, 40, 40, 4, 4, 32, 32, 7, 32, 32,
+    32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 7, 32, 32,
+    4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 4, 40, 4, 4, 4,
+    4, 4, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 40, 40, 40, 4, 4, 4, 4, 4, 4, 4, 4, 4, 40,
+    40, 32, 39, 39, 32, 32, 32, 32, 32, 4, 4, 4, 4, 32, 40, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 40, 4,
+    4, 4, 40, 40, 4, 40, 4, 4, 32, 32, 32, 32, 32, 32, 4, 32,
+    40, 40, 40, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    4, 40, 40, 40, 40, 32, 32, 40, 40, 32, 32, 40, 40, 40, 32, 32,
+    32, 32, 40, 40, 32, 32, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32,
+    32, 32, 32, 32, 32, 40, 40, 40, 4, 4, 4, 4, 4, 4, 4, 4,
+    40, 40, 4, 4, 4, 40, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    36, 40, 40, 4, 4, 4, 4, 4, 4, 40, 4, 40, 40, 36, 40, 4,
+    4, 40, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 36,
+    40, 40, 4, 4, 4, 4, 32, 32, 40, 40, 40, 40, 4, 4, 40, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 32, 32,
+    40, 40, 40, 4, 4, 4, 4, 4, 4, 4, 4, 40, 40, 4, 40, 4,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 40, 4, 40, 40,
+    4, 4, 4, 4, 4, 4, 40, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 4, 4, 4, 4, 40, 4, 4, 4, 4, 4, 32, 32, 32, 32,
+    4, 4, 4, 4, 4, 4, 4, 4, 40, 4, 4, 32, 32, 32, 32, 32,
+    36, 40, 40, 40, 40, 40, 32, 40, 40, 32, 32, 4, 4, 40, 4, 39,
+    40, 39, 40, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 40, 40, 40, 4, 4, 4, 4, 32, 32, 4, 4, 40, 40, 40, 40,
+    4, 32, 32, 32, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    32, 32, 32, 4, 4, 4, 4, 4, 4, 40, 39, 4, 4, 4, 4, 32,
+    32, 32, 32, 32, 32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 4, 4, 4, 4, 4, 4, 40, 40, 4, 4, 4, 32, 32, 32, 32,
+    32, 32, 32, 32, 39, 39, 39, 39, 39, 39, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 40, 4, 4, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40,
+    4, 4, 4, 4, 4, 4, 4, 32, 4, 4, 4, 4, 4, 4, 40, 4,
+    32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 32, 40, 4, 4, 4, 4, 4, 4,
+    4, 40, 4, 4, 40, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 4, 4, 4, 4, 4, 4, 32, 32, 32, 4, 32, 4, 4, 32, 4,
+    4, 4, 4, 4, 4, 4, 39, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 40, 40, 40, 32,
+    4, 4, 32, 40, 40, 4, 40, 4, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 4, 4, 40, 40, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 32, 32, 32, 32, 32, 32, 32,
+    32, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 32, 32, 32, 32, 32, 32, 32, 4,
+    64, 64, 64, 64, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    72, 72, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 32, 32, 32,
+    64, 64, 64, 64, 32, 64, 64, 64, 64, 64, 64, 64, 32, 64, 64, 32,
+    64, 64, 64, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 64, 64, 64, 64, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 32,
+    3, 3, 3, 3, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32,
+    32, 32, 32, 32, 32, 36, 40, 4, 4, 4, 32, 32, 32, 40, 36, 36,
+    36, 36, 36, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+    4, 4, 4, 32, 32, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4, 32, 32,
+    32, 32, 4, 4, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 4, 4, 4, 4, 4,
+    32, 32, 32, 32, 4, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    4, 4, 4, 4, 4, 4, 4, 32, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 4, 4, 4, 4, 4,
+    4, 4, 32, 4, 4, 32, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 4, 4, 4, 4,
+    32, 32, 32, 32, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
+    48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 32,
+    32, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 32, 32, 32, 32, 32,
+    48, 48, 48, 48, 48, 48, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    64, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 80, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 80,
+    64, 64, 80, 80, 80, 80, 80, 80, 80, 80, 80, 64, 48, 48, 48, 48,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 48, 48, 48, 48, 48, 48, 48,
+    80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 48, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 80,
+    80, 48, 48, 48, 80, 48, 48, 48, 80, 80, 80, 68, 68, 68, 68, 68,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48,
+    80, 48, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 32, 32,
+    32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 80, 80, 80, 80, 48,
+    80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 48, 48, 80, 48, 48, 48,
+    80, 80, 80, 48, 48, 80, 80, 80, 48, 48, 48, 48, 48, 80, 80, 80,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 80, 80, 48, 48, 48,
+    48, 48, 48, 48, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48,
+    32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48, 48,
+    80, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 32, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 32, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 48, 48, 48, 80, 80, 80, 80, 80, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 48,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32,
+    35, 3, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+};
+
+constexpr std::uint8_t grapheme_lookup(uint_t cp) noexcept
+{
+    const uint_t block = grapheme_stage2[(grapheme_stage1[cp >> 9] << 5) + ((cp >> 4) & 31)];
+    return grapheme_data[(block << 4) + (cp & 15)];
+}
+
+} // namespace impl
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_unicode_tables.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,416 @@
+#!/usr/bin/env python3
+#
+# Simple UTF library for C++
+#
+# Generator of compact Unicode property tables, reads text files of Unicode Character Database
+# (https://www.unicode.org/Public/UCD/latest/ucd/) and writes include/sutfcpplib/utf_unicode_tables.h
+#
+# usage: unicode_tables.py <ucd directory> [output header]
+#
+
+import os
+import sys
+
+CODE_POINTS = 0x110000
+
+# order must match sutf::general_category
+
+CATEGORIES = [
+    'Cn', 'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Ps',
+    'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co',
+]
+
+# flags of property table, low bits hold general category
+
+WHITE_SPACE = 0x20
+
+# order must match sutf::impl::grapheme_break
+
+GRAPHEME_BREAKS = [
+    'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend', 'SpacingMark',
+    'L', 'V', 'T', 'LV', 'LVT',
+]
+
+# flags of grapheme table, low bits hold grapheme cluster break property, display width is stored
+# in bits 5-6
+
+EXTENDED_PICTOGRAPHIC = 0x10
+WIDTH_SHIFT = 5
+
+# flags of normalization table, low bits hold canonical combining class
+
+NFC_MAYBE = 0x100
+NFC_NO = 0x200
+
+HEADER = '''////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple UTF library for C++
+// version 1.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2022 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// generated by tools/unicode_tables.py from Unicode Character Database {version}, don't edit
+
+#pragma once
+
+#include "utf_codepoint.h"
+
+namespace sutf
+{
+namespace impl
+{
+'''
+
+FOOTER = '''} // namespace impl
+} // namespace sutf
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of utf_unicode_tables.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
+'''
+
+
+
+####################################################################################################
+# parsing of UCD files
+
+def parse_ranges(path):
+    """yield (first, last, fields) for every data line of UCD file"""
+
+    with open(path, encoding='utf-8') as file:
+        for line in file:
+            line = line.split('#', 1)[0].strip()
+
+            if not line:
+                continue
+
+            fields = [field.strip() for field in line.split(';')]
+            bounds = fields[0].split('..')
+
+            yield int(bounds[0], 16), int(bounds[-1], 16), fields[1:]
+
+
+
+def read_version(ucd):
+    """version of UCD from ReadMe.txt or the first line of DerivedGeneralCategory.txt"""
+
+    with open(os.path.join(ucd, 'DerivedGeneralCategory.txt'), encoding='utf-8') as file:
+        line = file.readline()
+
+    if line.startswith('# DerivedGeneralCategory-'):
+        return line.split('-', 1)[1].split('.txt', 1)[0]
+
+    return 'files'
+
+
+
+def load_properties(ucd):
+    """general category and white space flag of every code point"""
+
+    values = [0] * CODE_POINTS
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'DerivedGeneralCategory.txt')):
+        category = CATEGORIES.index(fields[0])
+
+        for cp in range(first, last + 1):
+            values[cp] = category
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'PropList.txt')):
+        if fields[0] == 'White_Space':
+            for cp in range(first, last + 1):
+                values[cp] |= WHITE_SPACE
+
+    return values
+
+
+
+def load_case_folding(ucd):
+    """simple case folding of every code point as index of distinct difference and the differences"""
+
+    deltas = [0]
+    values = [0] * CODE_POINTS
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'CaseFolding.txt')):
+        if fields[0] in ('C', 'S'):
+            delta = int(fields[1], 16) - first
+
+            if delta not in deltas:
+                deltas.append(delta)
+
+            values[first] = deltas.index(delta)
+
+    return values, deltas
+
+
+
+def load_graphemes(ucd, properties):
+    """grapheme cluster break property, extended pictographic flag and display width of every code
+    point, zero width have marks, format and control characters and Hangul vowels and trailing
+    consonants, two columns take wide and fullwidth East Asian characters"""
+
+    values = [0] * CODE_POINTS
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'GraphemeBreakProperty.txt')):
+        for cp in range(first, last + 1):
+            values[cp] = GRAPHEME_BREAKS.index(fields[0])
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'emoji-data.txt')):
+        if fields[0] == 'Extended_Pictographic':
+            for cp in range(first, last + 1):
+                values[cp] |= EXTENDED_PICTOGRAPHIC
+
+    widths = [1] * CODE_POINTS
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'EastAsianWidth.txt')):
+        if fields[0] in ('W', 'F'):
+            for cp in range(first, last + 1):
+                widths[cp] = 2
+
+    zero_width = {CATEGORIES.index(category) for category in ('Mn', 'Me', 'Cf', 'Cc', 'Zl', 'Zp', 'Cs')}
+    jamo = {GRAPHEME_BREAKS.index(value) for value in ('V', 'T')}
+
+    for cp in range(CODE_POINTS):
+        if (properties[cp] & 0x1f in zero_width and cp != 0xad) or values[cp] & 0xf in jamo:
+            widths[cp] = 0
+
+        values[cp] |= widths[cp] << WIDTH_SHIFT
+
+    return values
+
+
+
+def load_normalization(ucd):
+    """combining class and NFC quick check of every code point, full canonical decompositions and
+    primary composites"""
+
+    values = [0] * CODE_POINTS
+    mappings = {}
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'UnicodeData.txt')):
+        for cp in range(first, last + 1):
+            values[cp] = int(fields[2] or 0)
+
+        if fields[4] and not fields[4].startswith('<'):
+            mappings[first] = [int(unit, 16) for unit in fields[4].split()]
+
+    exclusions = set()
+
+    for first, last, fields in parse_ranges(os.path.join(ucd, 'DerivedNormalizationProps.txt')):
+        for cp in range(first, last + 1):
+            if fields[0] == 'NFC_QC':
+                values[cp] |= NFC_MAYBE if fields[1] == 'M' else NFC_NO
+            elif fields[0] == 'Full_Composition_Exclusion':
+                exclusions.add(cp)
+
+    def decompose(cp):
+        return [unit for part in mappings[cp] for unit in decompose(part)] if cp in mappings else [cp]
+
+    # decomposition table holds offset in bits 3-15 and length in bits 0-2
+
+    decompositions = [0] * CODE_POINTS
+    data = []
+
+    for cp in sorted(mappings):
+        units = decompose(cp)
+        decompositions[cp] = len(data) << 3 | len(units)
+        data.extend(units)
+
+    assert len(data) < 0x2000 and max(decompositions) < 0x10000
+
+    # composites are sorted by pair of the first and the second code point
+
+    compositions = sorted(mapping[0] << 42 | mapping[1] << 21 | cp for cp, mapping in mappings.items() if len(mapping) == 2 and cp not in exclusions)
+
+    return values, decompositions, data, compositions
+
+
+
+####################################################################################################
+# table compression
+
+def split_blocks(values, shift):
+    """split values to deduplicated blocks of 1 << shift entries, return index and blocks"""
+
+    size = 1 << shift
+    blocks = {}
+    index = []
+    data = []
+
+    for start in range(0, len(values), size):
+        block = tuple(values[start:start + size])
+
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            data.extend(block)
+
+        index.append(blocks[block])
+
+    return index, data
+
+
+
+def element_size(values):
+    if min(values) < 0:
+        return 1 if -0x80 <= min(values) and max(values) < 0x80 else 2 if -0x8000 <= min(values) and max(values) < 0x8000 else 4
+
+    return 1 if max(values) < 0x100 else 2 if max(values) < 0x10000 else 4 if max(values) < 0x100000000 else 8
+
+
+
+def three_stage(values):
+    """find block sizes of three stage table with minimal total size"""
+
+    best = None
+
+    for shift3 in range(3, 9):
+        index2, data = split_blocks(values, shift3)
+
+        for shift2 in range(2, 9):
+            index1, stage2 = split_blocks(index2, shift2)
+            size = len(index1) * element_size(index1) + len(stage2) * element_size(stage2) + len(data) * element_size(data)
+
+            if best is None or size < best[0]:
+                best = (size, shift2, shift3, index1, stage2, data)
+
+    return best
+
+
+
+def element_type(values):
+    return ('std::int{}_t' if min(values) < 0 else 'std::uint{}_t').format(element_size(values) * 8)
+
+
+
+def emit_array(out, name, values):
+    out.append('inline constexpr {} {}[] = {{'.format(element_type(values), name))
+
+    if element_size(values) == 8:
+        for start in range(0, len(values), 4):
+            out.append('    ' + ', '.join('0x{:016x}'.format(value) for value in values[start:start + 4]) + ',')
+
+        out.append('};')
+        out.append('')
+        return
+
+    for start in range(0, len(values), 16):
+        out.append('    ' + ', '.join(str(value) for value in values[start:start + 16]) + ',')
+
+    out.append('};')
+    out.append('')
+
+
+
+def emit_table(out, name, comment, values):
+    """write three stage table and its lookup routine"""
+
+    size, shift2, shift3, stage1, stage2, data = three_stage(values)
+
+    out.append('////////////////////////////////////////////////////////////////////////////////////////////////////')
+    out.append('// {}, {} bytes'.format(comment, size))
+    out.append('')
+
+    emit_array(out, name + '_stage1', stage1)
+    emit_array(out, name + '_stage2', stage2)
+    emit_array(out, name + '_data', data)
+
+    out.append('constexpr {} {}_lookup(uint_t cp) noexcept'.format(element_type(data), name))
+    out.append('{')
+    out.append('    const uint_t block = {}_stage2[({}_stage1[cp >> {}] << {}) + ((cp >> {}) & {})];'.format(name, name, shift2 + shift3, shift2, shift3, (1 << shift2) - 1))
+    out.append('    return {}_data[(block << {}) + (cp & {})];'.format(name, shift3, (1 << shift3) - 1))
+    out.append('}')
+    out.append('')
+    out.append('')
+    out.append('')
+
+    return size
+
+
+
+####################################################################################################
+# main entry point
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit('usage: unicode_tables.py <ucd directory> [output header]')
+
+    ucd = sys.argv[1]
+    path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(os.path.dirname(__file__), '..', 'include', 'sutfcpplib', 'utf_unicode_tables.h')
+
+    out = []
+    total = 0
+
+    properties = load_properties(ucd)
+    total += emit_table(out, 'property', 'general category in bits 0-4, white space in bit 5', properties)
+
+    fold, deltas = load_case_folding(ucd)
+    total += emit_table(out, 'fold', 'simple case folding, index of difference between folded and source code point', fold)
+    total += len(deltas) * element_size(deltas)
+
+    out.append('////////////////////////////////////////////////////////////////////////////////////////////////////')
+    out.append('// differences between folded and source code points')
+    out.append('')
+    emit_array(out, 'fold_delta', deltas)
+    out.append('')
+    out.append('')
+
+    normalization, decompositions, data, compositions = load_normalization(ucd)
+    total += emit_table(out, 'normalization', 'canonical combining class in bits 0-7, NFC quick check maybe in bit 8, no in bit 9', normalization)
+    total += emit_table(out, 'decomposition', 'full canonical decomposition, offset in bits 3-15 and length in bits 0-2', decompositions)
+    total += len(data) * element_size(data) + len(compositions) * 8
+
+    out.append('////////////////////////////////////////////////////////////////////////////////////////////////////')
+    out.append('// code points of canonical decompositions')
+    out.append('')
+    emit_array(out, 'decomposition_units', data)
+    out.append('')
+    out.append('')
+
+    out.append('////////////////////////////////////////////////////////////////////////////////////////////////////')
+    out.append('// primary composites, the first code point in bits 42-62, the second in bits 21-41, composite')
+    out.append('// in bits 0-20, sorted')
+    out.append('')
+    emit_array(out, 'composition_pairs', compositions)
+    out.append('')
+    out.append('')
+
+    total += emit_table(out, 'grapheme', 'grapheme cluster break in bits 0-3, extended pictographic in bit 4, width in bits 5-6', load_graphemes(ucd, properties))
+
+    while out[-1] == '':
+        out.pop()
+
+    with open(path, 'w', encoding='utf-8', newline='\n') as file:
+        file.write(HEADER.replace('{version}', read_version(ucd)))
+        file.write('\n'.join(out) + '\n\n')
+        file.write(FOOTER)
+
+    print('{}: {} bytes of tables'.format(path, total))
+
+
+
+if __name__ == '__main__':
+    main()